@@ -0,0 +1,157 @@
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Сравнение быстродействия алгоритмов сортировки Ural и стандартной библиотеки.
+
+Для каждого типа элементов выводится время работы std::sort, ural::sort
+и ural::radix_sort на одних и тех же данных, а также отношение времени работы
+ural::sort к времени работы std::sort. Аналогично сравниваются std::stable_sort
+и ural::stable_sort. Время ural::pdq_sort не выводится: это та же сортировка,
+что и ural::sort. Затем для ural::sort(ural::par(k), ...) и
+ural::stable_sort(ural::par(k), ...) выводится ускорение относительно
+последовательных вариантов в зависимости от количества потоков k. Первый
+аргумент командной строки задаёт размер массивов (по умолчанию --- 1'000'000).
+*/
+
+/// @cond false
+
+#include <ural/algorithm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    typedef std::mt19937 Random_engine;
+
+    template <class F>
+    double measure(F f)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        f();
+        auto const finish = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double>(finish - start).count();
+    }
+
+    template <class T, class Generator>
+    void compare_sorts(char const * name, std::size_t n, Generator gen)
+    {
+        std::vector<T> x_std;
+        x_std.reserve(n);
+        std::generate_n(std::back_inserter(x_std), n, gen);
+
+        auto x_ural = x_std;
+        auto x_radix = x_std;
+        auto x_std_stable = x_std;
+        auto x_ural_stable = x_std;
+
+        auto const t_std = measure([&]{ std::sort(x_std.begin(), x_std.end()); });
+        auto const t_ural = measure([&]{ ural::sort(x_ural); });
+        auto const t_radix = measure([&]{ ural::radix_sort(x_radix); });
+        auto const t_std_stable
+            = measure([&]{ std::stable_sort(x_std_stable.begin(), x_std_stable.end()); });
+        auto const t_ural_stable = measure([&]{ ural::stable_sort(x_ural_stable); });
+
+        std::cout << name << "\t"
+                  << "std::sort: " << t_std << "\t"
+                  << "ural::sort: " << t_ural << "\t"
+                  << "ratio: " << t_ural / t_std << "\t"
+                  << "ural::radix_sort: " << t_radix << "\t"
+                  << "std::stable_sort: " << t_std_stable << "\t"
+                  << "ural::stable_sort: " << t_ural_stable
+                  << (x_std == x_ural && x_std == x_radix
+                      && x_std == x_std_stable
+                      && x_std == x_ural_stable ? "" : "\tFAILED")
+                  << "\n";
+    }
+
+    template <class T, class Generator>
+    void parallel_speedup(char const * name, std::size_t n, Generator gen)
+    {
+        std::vector<T> x;
+        x.reserve(n);
+        std::generate_n(std::back_inserter(x), n, gen);
+
+        auto x_seq = x;
+        auto x_seq_stable = x;
+
+        auto const t_seq = measure([&]{ ural::sort(x_seq); });
+        auto const t_seq_stable = measure([&]{ ural::stable_sort(x_seq_stable); });
+
+        auto const max_threads = ural::par.threads();
+
+        for(std::size_t k = 1; k <= max_threads; k *= 2)
+        {
+            auto x_par = x;
+            auto x_par_stable = x;
+
+            auto const t_par = measure([&]{ ural::sort(ural::par(k), x_par); });
+            auto const t_par_stable
+                = measure([&]{ ural::stable_sort(ural::par(k), x_par_stable); });
+
+            std::cout << name << "\t"
+                      << "threads: " << k << "\t"
+                      << "sort speedup: " << t_seq / t_par << "\t"
+                      << "stable_sort speedup: " << t_seq_stable / t_par_stable
+                      << (x_seq == x_par && x_seq == x_par_stable ? "" : "\tFAILED")
+                      << "\n";
+        }
+    }
+}
+
+int main(int argc, char const * argv[])
+{
+    std::size_t n = 1'000'000;
+
+    if(argc > 1)
+    {
+        n = std::atoi(argv[1]);
+    }
+
+    Random_engine rnd(std::random_device{}());
+
+    std::uniform_int_distribution<int> int_d;
+    std::uniform_real_distribution<double> double_d(-1e6, 1e6);
+
+    compare_sorts<int>("int", n, [&]{ return int_d(rnd); });
+    compare_sorts<double>("double", n, [&]{ return double_d(rnd); });
+    compare_sorts<std::string>("string", n,
+                               [&]{ return std::to_string(int_d(rnd)); });
+
+    // Почти упорядоченный временной ряд: редкие выбросы
+    std::bernoulli_distribution outlier_d(0.01);
+    int time_point = 0;
+    compare_sorts<int>("nearly sorted int", n, [&]
+    {
+        ++ time_point;
+        return outlier_d(rnd) ? int_d(rnd) % n : time_point;
+    });
+
+    parallel_speedup<int>("int", n, [&]{ return int_d(rnd); });
+    parallel_speedup<double>("double", n, [&]{ return double_d(rnd); });
+
+    return 0;
+}
+
+/// @endcond
@@ -23,8 +23,14 @@
 #include <ural/math/rational.hpp>
 #include <ural/numeric/numbers_sequence.hpp>
 
+#include <cmath>
+#include <deque>
 #include <forward_list>
 #include <list>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <boost/test/unit_test.hpp>
@@ -252,6 +258,41 @@ BOOST_AUTO_TEST_CASE(copy_if_test_to_shorter_container)
     BOOST_CHECK(result_ural[ural::_2].end() == r_ural.end());
 }
 
+BOOST_AUTO_TEST_CASE(copy_if_test_contiguous_random)
+{
+    std::vector<int> xs(1000);
+    std::uniform_int_distribution<int> d(0, 99);
+    for(auto & x : xs)
+    {
+        x = d(ural_test::random_engine());
+    }
+
+    auto const pred = [](int x) { return x < 50; };
+
+    std::vector<int> r_std;
+    std::copy_if(xs.begin(), xs.end(), std::back_inserter(r_std), pred);
+
+    for(auto n : {r_std.size() + 10, r_std.size(), r_std.size() / 3, size_t(0)})
+    {
+        std::vector<int> r_ural(n, -1);
+
+        auto const result = ural::copy_if(xs, r_ural, pred);
+
+        auto const n_copied = std::min(n, r_std.size());
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.begin() + n_copied,
+                                      r_std.begin(), r_std.begin() + n_copied);
+        BOOST_CHECK(std::all_of(r_ural.begin() + n_copied, r_ural.end(),
+                                [](int x) { return x == -1; }));
+
+        BOOST_CHECK_EQUAL(result[ural::_2].traversed_front().size(),
+                          ural::to_signed(n_copied));
+        BOOST_CHECK_EQUAL(::ural::count_if(result[ural::_1].traversed_front(), pred),
+                          ural::to_signed(n_copied));
+        BOOST_CHECK(!result[ural::_1] || pred(result[ural::_1].front()));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(copy_backward_test)
 {
     std::vector<int> x_std = {1, 2, 3, 4, 5};
@@ -489,6 +530,84 @@ BOOST_AUTO_TEST_CASE(move_backward_to_longer_test)
     BOOST_CHECK(r2[ural::_2].traversed_end() == x2.end());
 }
 
+BOOST_AUTO_TEST_CASE(copy_test_contiguous_overlapping)
+{
+    std::vector<long> x_std(1000);
+    std::iota(x_std.begin(), x_std.end(), 1);
+    auto x_ural = x_std;
+
+    auto const shift = 37;
+
+    std::copy(x_std.begin() + shift, x_std.end(), x_std.begin());
+
+    auto src = ural::make_iterator_cursor(x_ural.begin() + shift, x_ural.end());
+    auto const r = ural::copy(src, x_ural);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+
+    BOOST_CHECK(!r[ural::_1]);
+    BOOST_CHECK(r[ural::_2].begin() == x_ural.end() - shift);
+    BOOST_CHECK(r[ural::_2].traversed_begin() == x_ural.begin());
+}
+
+BOOST_AUTO_TEST_CASE(copy_backward_test_contiguous_overlapping)
+{
+    std::vector<double> x_std(1000);
+    std::iota(x_std.begin(), x_std.end(), 0.5);
+    auto x_ural = x_std;
+
+    auto const shift = 37;
+
+    std::copy_backward(x_std.begin(), x_std.end() - shift, x_std.end());
+
+    auto src = ural::make_iterator_cursor(x_ural.begin(), x_ural.end() - shift);
+    auto const r = ural::copy_backward(src, x_ural);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+
+    BOOST_CHECK(!r[ural::_1]);
+    BOOST_CHECK(r[ural::_1].traversed_end() == x_ural.end() - shift);
+    BOOST_CHECK(r[ural::_2].begin() == x_ural.begin());
+    BOOST_CHECK(r[ural::_2].end() == x_ural.begin() + shift);
+    BOOST_CHECK(r[ural::_2].traversed_end() == x_ural.end());
+}
+
+BOOST_AUTO_TEST_CASE(copy_n_test_contiguous)
+{
+    std::vector<int> const src = {1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> out(5, -1);
+
+    auto const r1 = ural::copy_n(src, 3, out);
+
+    std::vector<int> const z1 = {1, 2, 3, -1, -1};
+    URAL_CHECK_EQUAL_RANGES(out, z1);
+
+    BOOST_CHECK(r1[ural::_1].begin() == src.begin() + 3);
+    BOOST_CHECK(r1[ural::_2].begin() == out.begin() + 3);
+
+    auto const r2 = ural::copy_n(src, src.size(), out);
+
+    URAL_CHECK_EQUAL_RANGES(out, ural::make_iterator_cursor(src.begin(),
+                                                            src.begin() + out.size()));
+
+    BOOST_CHECK(r2[ural::_1].begin() == src.begin() + out.size());
+    BOOST_CHECK(!r2[ural::_2]);
+}
+
+BOOST_AUTO_TEST_CASE(move_test_contiguous_to_shorter)
+{
+    std::vector<int> const src = {1, 2, 3, 4, 5};
+    std::vector<int> out(3, 0);
+
+    auto const r = ural::move(src, out);
+
+    URAL_CHECK_EQUAL_RANGES(out, ural::make_iterator_cursor(src.begin(),
+                                                            src.begin() + out.size()));
+
+    BOOST_CHECK(r[ural::_1].begin() == src.begin() + out.size());
+    BOOST_CHECK(!r[ural::_2]);
+}
+
 // 25.3.3 Обмен интервалов
 BOOST_AUTO_TEST_CASE(swap_ranges_test_shorter_1)
 {
@@ -1032,6 +1151,45 @@ BOOST_AUTO_TEST_CASE(fill_n_test_negative_n)
     BOOST_CHECK(r_ural == ural::cursor(v_ural));
 }
 
+typedef boost::mpl::list<char, signed char, unsigned char, short, int, long long,
+                         float, double> Fill_contiguous_types;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(fill_test_contiguous, T, Fill_contiguous_types)
+{
+    std::vector<T> const values = {T(0), T(1), T(-1), T(-0.0), T(42.5)};
+
+    for(auto const & value : values)
+    {
+        std::vector<T> x_std(37, T(1));
+        auto x_ural = x_std;
+
+        std::fill(x_std.begin() + 3, x_std.end(), value);
+        auto const r = ural::fill(ural::make_iterator_cursor(x_ural.begin() + 3,
+                                                             x_ural.end()),
+                                  value);
+
+        URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+        BOOST_CHECK(!r);
+        BOOST_CHECK(r.traversed_begin() == x_ural.begin() + 3);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fill_n_test_contiguous_longer_n)
+{
+    std::vector<double> xs(10, 1.0);
+
+    auto const r = ural::fill_n(xs, xs.size() * 2, -0.0);
+
+    for(auto const & x : xs)
+    {
+        BOOST_CHECK_EQUAL(x, 0.0);
+        BOOST_CHECK(std::signbit(x));
+    }
+
+    BOOST_CHECK(!r);
+    BOOST_CHECK(r.traversed_begin() == xs.begin());
+}
+
 // 25.3.7 Порождениеs
 BOOST_AUTO_TEST_CASE(generate_test)
 {
@@ -1348,6 +1506,27 @@ BOOST_AUTO_TEST_CASE(remove_if_test)
     BOOST_CHECK_EQUAL(&ref_ural, &s_ural);
 }
 
+BOOST_AUTO_TEST_CASE(remove_if_test_contiguous_random)
+{
+    std::vector<double> s_std(1000);
+    std::uniform_real_distribution<double> d(0.0, 1.0);
+    for(auto & x : s_std)
+    {
+        x = d(ural_test::random_engine());
+    }
+
+    auto s_ural = s_std;
+
+    auto const pred = [](double x) { return x < 0.5; };
+
+    s_std.erase(std::remove_if(s_std.begin(), s_std.end(), pred), s_std.end());
+
+    auto s = ural::remove_if(s_ural, pred);
+
+    BOOST_CHECK(s.original() == ural::cursor(s_ural));
+    URAL_CHECK_EQUAL_RANGES(s.traversed_front(), s_std);
+}
+
 BOOST_AUTO_TEST_CASE(remove_if_erase_test)
 {
     std::string s_std = "Text\n with\tsome \t  whitespaces\n\n";
@@ -1781,6 +1960,55 @@ BOOST_AUTO_TEST_CASE(rotate_test)
     }
 }
 
+namespace
+{
+    typedef boost::mpl::list<std::forward_list<int>, std::list<int>,
+                             std::deque<int>, std::vector<int>,
+                             std::vector<std::string>> Rotate_containers;
+
+    template <class T>
+    T make_rotate_test_value(int i)
+    {
+        return T(i);
+    }
+
+    template <>
+    std::string make_rotate_test_value<std::string>(int i)
+    {
+        return std::to_string(i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(rotate_test_categories, Container, Rotate_containers)
+{
+    using Value = ural::value_type_t<Container>;
+
+    // Массив не помещается целиком в буфер, используемый при повороте
+    auto const n = 10000;
+
+    std::vector<Value> src;
+
+    for(auto i : ural::numbers(0, n))
+    {
+        src.push_back(make_rotate_test_value<Value>(i));
+    }
+
+    for(auto k : {0, 1, 2, 100, 2500, n/2 - 1, n/2, n/2 + 1, 7919, n - 2, n - 1})
+    {
+        Container v_std(src.begin(), src.end());
+        Container v_ural(src.begin(), src.end());
+
+        std::rotate(v_std.begin(), std::next(v_std.begin(), k), v_std.end());
+
+        auto const r = ural::rotate(ural::next(ural::cursor(v_ural), k));
+
+        URAL_CHECK_EQUAL_RANGES(v_std, v_ural);
+
+        BOOST_CHECK(r.original() == ural::cursor(v_ural));
+        BOOST_CHECK_EQUAL(ural::size(r.traversed_front()) % n, (n - k) % n);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(rotate_copy_test)
 {
     std::vector<int> const src{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
@@ -1920,6 +2148,154 @@ BOOST_AUTO_TEST_CASE(random_shuffle_test)
     BOOST_CHECK(ural::is_permutation(v, v_old));
 }
 
+BOOST_AUTO_TEST_CASE(shuffle_test_all_permutations_equally_likely)
+{
+    std::mt19937_64 g;
+
+    std::vector<int> const v_old = {1, 2, 3};
+    std::map<std::vector<int>, int> counts;
+
+    auto const per_permutation = 10000;
+
+    for(auto i = 0; i < 6 * per_permutation; ++ i)
+    {
+        auto v = v_old;
+        ural::shuffle(v, g);
+        ++ counts[v];
+    }
+
+    BOOST_CHECK_EQUAL(counts.size(), 6U);
+
+    for(auto const & p : counts)
+    {
+        BOOST_CHECK_GT(p.second, per_permutation * 95 / 100);
+        BOOST_CHECK_LT(p.second, per_permutation * 105 / 100);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sample_test_forward)
+{
+    std::forward_list<int> const src = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    std::vector<int> out(4, 0);
+
+    auto const r = ural::sample(src, out, out.size(), ural_test::random_engine());
+
+    BOOST_CHECK(!r[ural::_1]);
+    BOOST_CHECK(!r[ural::_2]);
+
+    BOOST_CHECK(std::is_sorted(out.begin(), out.end()));
+    BOOST_CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+    BOOST_CHECK(std::includes(src.begin(), src.end(), out.begin(), out.end()));
+}
+
+BOOST_AUTO_TEST_CASE(sample_test_to_shorter)
+{
+    std::vector<int> const src = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    std::vector<int> out(3, 0);
+
+    auto const r = ural::sample(src, out, 5, ural_test::random_engine());
+
+    BOOST_CHECK(!r[ural::_1]);
+    BOOST_CHECK(!r[ural::_2]);
+
+    BOOST_CHECK(std::is_sorted(out.begin(), out.end()));
+    BOOST_CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+    BOOST_CHECK(std::includes(src.begin(), src.end(), out.begin(), out.end()));
+
+    // Выборка должна быть равномерной, а не смещённой к началу src
+    std::vector<int> counts(src.size() + 1, 0);
+
+    auto const runs = 30000;
+
+    for(auto i = 0; i < runs; ++ i)
+    {
+        ural::sample(src, out, 5, ural_test::random_engine());
+
+        for(auto const & x : out)
+        {
+            ++ counts[x];
+        }
+    }
+
+    // Каждый элемент выбирается с вероятностью out.size() / src.size()
+    auto const expected = runs * static_cast<int>(out.size()) / static_cast<int>(src.size());
+
+    for(auto i = 1U; i < counts.size(); ++ i)
+    {
+        BOOST_CHECK_GT(counts[i], expected * 95 / 100);
+        BOOST_CHECK_LT(counts[i], expected * 105 / 100);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sample_test_more_than_size)
+{
+    std::vector<int> const src = {1, 2, 3, 4, 5};
+
+    std::vector<int> out(10, 0);
+
+    auto const r = ural::sample(src, out, 7, ural_test::random_engine());
+
+    BOOST_CHECK(!r[ural::_1]);
+    BOOST_CHECK(r[ural::_2].begin() == out.begin() + src.size());
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.begin() + src.size(),
+                                  src.begin(), src.end());
+}
+
+BOOST_AUTO_TEST_CASE(sample_test_input)
+{
+    std::vector<int> const src = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    ural_test::istringstream_helper<int> xs(src);
+
+    std::vector<int> out(4, 0);
+
+    auto const r = ural::sample(xs, out, out.size(), ural_test::random_engine());
+
+    BOOST_CHECK(!r[ural::_1]);
+    BOOST_CHECK(!r[ural::_2]);
+
+    std::sort(out.begin(), out.end());
+
+    BOOST_CHECK(std::adjacent_find(out.begin(), out.end()) == out.end());
+    BOOST_CHECK(std::includes(src.begin(), src.end(), out.begin(), out.end()));
+}
+
+BOOST_AUTO_TEST_CASE(sample_test_equally_likely)
+{
+    std::mt19937 g;
+
+    std::vector<int> const src = {0, 1, 2, 3, 4};
+
+    std::vector<int> counts_forward(src.size(), 0);
+    std::vector<int> counts_input(src.size(), 0);
+
+    auto const per_element = 10000;
+
+    for(auto i = 0; i < per_element * 5 / 2; ++ i)
+    {
+        std::vector<int> out(2);
+
+        ural::sample(src, out, out.size(), g);
+        ++ counts_forward[out[0]];
+        ++ counts_forward[out[1]];
+
+        ural_test::istringstream_helper<int> xs(src);
+        ural::sample(xs, out, out.size(), g);
+        ++ counts_input[out[0]];
+        ++ counts_input[out[1]];
+    }
+
+    for(auto i : ural::indices_of(src))
+    {
+        BOOST_CHECK_GT(counts_forward[i], per_element * 95 / 100);
+        BOOST_CHECK_LT(counts_forward[i], per_element * 105 / 100);
+        BOOST_CHECK_GT(counts_input[i], per_element * 95 / 100);
+        BOOST_CHECK_LT(counts_input[i], per_element * 105 / 100);
+    }
+}
+
 // 25.3.13 Разделение
 BOOST_AUTO_TEST_CASE(is_partitioned_test)
 {
@@ -2103,6 +2479,174 @@ BOOST_AUTO_TEST_CASE(stable_partition_test_9)
     BOOST_CHECK(std::none_of(r_ural.begin(), r_ural.traversed_end(), pred));
 }
 
+BOOST_AUTO_TEST_CASE(stable_partition_test_strings_forward_list)
+{
+    std::forward_list<std::string> src;
+    for(auto i = 0; i < 200; ++ i)
+    {
+        src.push_front(std::to_string(i * 7 % 200));
+    }
+
+    auto v_std = std::vector<std::string>(src.begin(), src.end());
+
+    auto const pred = [](std::string const & s) { return s.size() == 2; };
+
+    std::stable_partition(v_std.begin(), v_std.end(), pred);
+
+    auto v_ural = src;
+    auto r_ural = ural::stable_partition(v_ural, pred);
+
+    URAL_CHECK_EQUAL_RANGES(v_std, v_ural);
+
+    BOOST_CHECK(::ural::all_of(r_ural.traversed_front(), pred));
+    BOOST_CHECK(::ural::none_of(r_ural, pred));
+
+    // Без буфера
+    auto v_inplace = src;
+    std::vector<std::string> scratch;
+    auto r_inplace = ural::stable_partition(v_inplace, pred, scratch);
+
+    URAL_CHECK_EQUAL_RANGES(v_std, v_inplace);
+
+    BOOST_CHECK(::ural::all_of(r_inplace.traversed_front(), pred));
+    BOOST_CHECK(::ural::none_of(r_inplace, pred));
+}
+
+BOOST_AUTO_TEST_CASE(stable_partition_test_scratch_buffer)
+{
+    std::vector<int> src(100);
+    std::iota(src.begin(), src.end(), 0);
+
+    auto const pred = [](int n){return n % 3 == 0;};
+
+    auto v_std = src;
+    std::stable_partition(v_std.begin(), v_std.end(), pred);
+
+    auto const n_true = std::count_if(src.begin(), src.end(), pred);
+
+    for(auto scratch_size : {100, 66, 20, 1, 0})
+    {
+        auto v_ural = src;
+        std::vector<int> scratch(scratch_size, -1);
+
+        auto const r_ural = ural::stable_partition(v_ural, pred, scratch);
+
+        URAL_CHECK_EQUAL_RANGES(v_std, v_ural);
+
+        BOOST_CHECK(r_ural.original() == ural::cursor(v_ural));
+        BOOST_CHECK_EQUAL(r_ural.traversed_front().size(), n_true);
+        BOOST_CHECK(::ural::none_of(r_ural, pred));
+    }
+}
+
+namespace
+{
+    /* Строка, которая считает количество живых объектов. При перемещении
+    исходный объект становится пустым, поэтому потерянные элементы видны.
+    */
+    class Live_counted
+    {
+    public:
+        static long & live()
+        {
+            static long inst = 0;
+            return inst;
+        }
+
+        explicit Live_counted(std::string x = std::string())
+         : value(std::move(x))
+        {
+            ++ live();
+        }
+
+        Live_counted(Live_counted const & x)
+         : value(x.value)
+        {
+            ++ live();
+        }
+
+        Live_counted(Live_counted && x)
+         : value(std::move(x.value))
+        {
+            x.value.clear();
+            ++ live();
+        }
+
+        Live_counted & operator=(Live_counted const &) = default;
+
+        Live_counted & operator=(Live_counted && x)
+        {
+            value = std::move(x.value);
+            x.value.clear();
+            return *this;
+        }
+
+        ~Live_counted()
+        {
+            -- live();
+        }
+
+        std::string value;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(stable_partition_test_throwing_predicate)
+{
+    auto const n = 50;
+
+    std::vector<std::string> src;
+    for(auto i = 0; i < n; ++ i)
+    {
+        src.push_back(std::to_string(i * 7 % n));
+    }
+
+    auto src_sorted = src;
+    std::sort(src_sorted.begin(), src_sorted.end());
+
+    // Размер буфера -1 означает выделение памяти самим алгоритмом
+    for(auto scratch_size : {-1, n, 10})
+    for(auto throw_at : {1, 2, n / 2, n - 1})
+    {
+        auto const live_old = Live_counted::live();
+        {
+            std::forward_list<Live_counted> xs(src.begin(), src.end());
+
+            auto calls = 0;
+            auto const pred = [&](Live_counted const & x)
+            {
+                if(++ calls == throw_at)
+                {
+                    throw std::runtime_error("stable_partition_test_throwing_predicate");
+                }
+
+                return x.value.size() == 1;
+            };
+
+            if(scratch_size < 0)
+            {
+                BOOST_CHECK_THROW(ural::stable_partition(xs, pred), std::runtime_error);
+            }
+            else
+            {
+                std::vector<Live_counted> scratch(scratch_size);
+                BOOST_CHECK_THROW(ural::stable_partition(xs, pred, scratch),
+                                  std::runtime_error);
+            }
+
+            // Последовательность остаётся перестановкой исходной
+            std::vector<std::string> values;
+            for(auto const & x : xs)
+            {
+                values.push_back(x.value);
+            }
+            std::sort(values.begin(), values.end());
+
+            URAL_CHECK_EQUAL_RANGES(src_sorted, values);
+        }
+        BOOST_CHECK_EQUAL(live_old, Live_counted::live());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(partition_copy_test)
 {
     // Подготовка
@@ -2170,6 +2714,47 @@ BOOST_AUTO_TEST_CASE(partition_copy_return_value_test)
                                   false_sink.end());
 }
 
+BOOST_AUTO_TEST_CASE(partition_copy_test_contiguous_to_shorter)
+{
+    std::vector<int> src(1000);
+    std::uniform_int_distribution<int> d(0, 99);
+    for(auto & x : src)
+    {
+        x = d(ural_test::random_engine());
+    }
+
+    auto const pred = [] (int x) {return x % 2 == 0;};
+
+    std::vector<int> true_std;
+    std::vector<int> false_std;
+    std::partition_copy(src.begin(), src.end(), std::back_inserter(true_std),
+                        std::back_inserter(false_std), pred);
+
+    std::vector<int> true_sink(true_std.size() / 2, -1);
+    std::vector<int> false_sink(src.size(), -1);
+
+    auto r = ural::partition_copy(src, true_sink, false_sink, pred);
+
+    // Копирование прекращается после заполнения true_sink
+    BOOST_CHECK(!r[ural::_2]);
+    BOOST_CHECK(!!r[ural::_1]);
+    BOOST_CHECK_EQUAL(r[ural::_1].traversed_front().size(),
+                      r[ural::_2].traversed_front().size()
+                      + r[ural::_3].traversed_front().size());
+    BOOST_CHECK(pred(r[ural::_1].traversed_front().back()));
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(true_sink.begin(), true_sink.end(),
+                                  true_std.begin(),
+                                  true_std.begin() + true_sink.size());
+
+    auto const n_false = r[ural::_3].traversed_front().size();
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(false_sink.begin(), false_sink.begin() + n_false,
+                                  false_std.begin(), false_std.begin() + n_false);
+    BOOST_CHECK(std::all_of(false_sink.begin() + n_false, false_sink.end(),
+                            [](int x) { return x == -1; }));
+}
+
 BOOST_AUTO_TEST_CASE(partition_point_test)
 {
     typedef int Value;
@@ -17,12 +17,14 @@
 #include <ural/algorithm.hpp>
 
 #include "../defs.hpp"
+#include "../rnd.hpp"
 
 #include <ural/numeric.hpp>
 
 #include <forward_list>
 #include <forward_list>
 #include <list>
+#include <numeric>
 #include <vector>
 
 #include <boost/mpl/list.hpp>
@@ -109,6 +111,90 @@ BOOST_AUTO_TEST_CASE(for_each_input_sequence_test)
     BOOST_CHECK_EQUAL(sum, ural::accumulate(src, 0));
 }
 
+namespace
+{
+    struct parallel_test_sum
+    {
+        void operator()(int x)
+        {
+            sum += x;
+            ++ calls;
+        }
+
+        long long sum = 0;
+        long long calls = 0;
+    };
+
+    std::vector<int> make_parallel_test_data(std::size_t n)
+    {
+        std::vector<int> result(n);
+
+        for(std::size_t i = 0; i < n; ++ i)
+        {
+            result[i] = static_cast<int>((i * 2654435761u) % 1000);
+        }
+
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_non_modifying_test)
+{
+    for(auto const n : {0, 10, 200000, 1000003})
+    {
+        auto const v = make_parallel_test_data(n);
+
+        for(auto const threads : {1, 3, 8})
+        {
+            auto const policy = ural::par(threads);
+
+            auto const less_500 = [](int x) { return x < 500; };
+
+            BOOST_CHECK_EQUAL(ural::count(policy, v, 17),
+                              std::count(v.begin(), v.end(), 17));
+            BOOST_CHECK_EQUAL(ural::count_if(policy, v, less_500),
+                              std::count_if(v.begin(), v.end(), less_500));
+
+            auto const non_negative = [](int x) { return x >= 0; };
+            auto const is_999 = [](int x) { return x == 999; };
+
+            BOOST_CHECK_EQUAL(ural::all_of(policy, v, non_negative),
+                              std::all_of(v.begin(), v.end(), non_negative));
+            BOOST_CHECK_EQUAL(ural::all_of(policy, v, less_500),
+                              std::all_of(v.begin(), v.end(), less_500));
+            BOOST_CHECK_EQUAL(ural::none_of(policy, v, is_999),
+                              std::none_of(v.begin(), v.end(), is_999));
+            BOOST_CHECK_EQUAL(ural::any_of(policy, v, is_999),
+                              std::any_of(v.begin(), v.end(), is_999));
+
+            auto const reduce = [](parallel_test_sum & acc, parallel_test_sum x)
+            {
+                acc.sum += x.sum;
+                acc.calls += x.calls;
+            };
+
+            auto const r = ural::for_each(policy, v, parallel_test_sum{}, reduce);
+
+            BOOST_CHECK(!r[ural::_1]);
+            BOOST_CHECK(r[ural::_1].traversed_begin() == v.begin());
+            BOOST_CHECK_EQUAL(r[ural::_2].calls, n);
+            BOOST_CHECK_EQUAL(r[ural::_2].sum,
+                              std::accumulate(v.begin(), v.end(), 0LL));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_all_of_test_last_element)
+{
+    auto v = make_parallel_test_data(1000000);
+    v.back() = -1;
+
+    auto const non_negative = [](int x) { return x >= 0; };
+
+    BOOST_CHECK(!ural::all_of(ural::par(4), v, non_negative));
+    BOOST_CHECK(ural::any_of(ural::par(4), v, [](int x) { return x < 0; }));
+}
+
 // 25.2.5
 BOOST_AUTO_TEST_CASE(find_fail_test_istream)
 {
@@ -259,6 +345,41 @@ BOOST_AUTO_TEST_CASE(adjacent_find_test)
     BOOST_CHECK_EQUAL(*r_std, *r_ural);
 }
 
+namespace
+{
+    typedef boost::mpl::list<char, unsigned char, short, int, unsigned int,
+                             long long, float, double>
+        Adjacent_find_types;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(adjacent_find_test_contiguous,
+                              Value, Adjacent_find_types)
+{
+    for(auto n : {0, 1, 2, 16, 17, 33, 70})
+    for(auto pos : {0, 1, 14, 15, 16, 31, 32, 68})
+    {
+        std::vector<Value> v;
+
+        for(auto i = 0; i < n; ++ i)
+        {
+            v.push_back(static_cast<Value>(i % 2 == 0 ? i / 2 : -i));
+        }
+
+        BOOST_CHECK(ural::adjacent_find(v).begin() == v.end());
+
+        if(pos + 1 < n)
+        {
+            v[pos + 1] = v[pos];
+        }
+
+        auto const r_std = std::adjacent_find(v.begin(), v.end());
+        auto const r_ural = ural::adjacent_find(v);
+
+        BOOST_CHECK(r_ural.begin() == r_std);
+        BOOST_CHECK(r_ural.end() == v.end());
+    }
+}
+
 // 25.2.9
 BOOST_AUTO_TEST_CASE(count_test)
 {
@@ -291,6 +412,88 @@ BOOST_AUTO_TEST_CASE(count_if_test)
     BOOST_CHECK_EQUAL(n_std, n_ural);
 }
 
+namespace
+{
+    typedef boost::mpl::list<char, signed char, unsigned char, short,
+                             unsigned int, long long, std::uint64_t>
+        Integer_types;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(find_count_test_contiguous, Value, Integer_types)
+{
+    std::vector<Value> data;
+
+    for(auto i = 0; i < 150; ++ i)
+    {
+        data.push_back(static_cast<Value>((i * 7) % 23));
+    }
+
+    for(auto offset : {0, 1, 3})
+    for(auto length : {0, 1, 15, 16, 17, 31, 33, 64, 100, 147})
+    {
+        auto const first = data.begin() + offset;
+        auto const last = first + length;
+        auto const in = ural::make_iterator_cursor(first, last);
+
+        for(int value : {0, 5, 22, 23, -1, 256 + 5})
+        {
+            auto const r = ural::find(in, value);
+
+            BOOST_CHECK(r.begin() == std::find(first, last, value));
+            BOOST_CHECK(r.end() == last);
+            BOOST_CHECK(r.traversed_begin() == first);
+
+            BOOST_CHECK_EQUAL(ural::count(in, value),
+                              std::count(first, last, value));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(find_first_of_test_contiguous, Value, Integer_types)
+{
+    std::vector<Value> data;
+
+    for(auto i = 0; i < 100; ++ i)
+    {
+        data.push_back(static_cast<Value>(i % 50));
+    }
+
+    std::vector<std::vector<int>> const needles
+        = {{}, {-1}, {49}, {45, 30}, {30, 45, 30}, {40, 41, 42, 43},
+           {-1, 300, 47, 48, 49}, {48, 47, 46, 45, 44, 43, 42}};
+
+    for(auto const & s : needles)
+    {
+        auto const r_std = std::find_first_of(data.begin(), data.end(),
+                                              s.begin(), s.end());
+        auto const r_ural = ural::find_first_of(data, s);
+
+        BOOST_CHECK(r_ural.begin() == r_std);
+        BOOST_CHECK(r_ural.end() == data.end());
+        BOOST_CHECK(r_ural.traversed_begin() == data.begin());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(find_first_of_test_byte_set)
+{
+    std::string const text = "key = value; # comment";
+    std::list<char> const data(text.begin(), text.end());
+
+    for(std::string const s : {"", "=", "#;", "\t\n#;=", "xyz"})
+    {
+        auto const r_std = std::find_first_of(data.begin(), data.end(),
+                                              s.begin(), s.end());
+        auto const r_ural = ural::find_first_of(data, s);
+
+        BOOST_CHECK(r_ural.begin() == r_std);
+
+        auto const r_str = ural::find_first_of(text, s);
+
+        BOOST_CHECK(r_str.begin() == std::find_first_of(text.begin(), text.end(),
+                                                        s.begin(), s.end()));
+    }
+}
+
 // 25.2.10
 BOOST_AUTO_TEST_CASE(mismatch_test)
 {
@@ -329,6 +532,39 @@ BOOST_AUTO_TEST_CASE(equal_test)
      BOOST_CHECK(ural::equal(x2, y2) == false);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(mismatch_equal_test_contiguous, Value, Integer_types)
+{
+    std::vector<Value> x;
+
+    for(auto i = 0; i < 100; ++ i)
+    {
+        x.push_back(static_cast<Value>(i * 37 - 50));
+    }
+
+    for(auto n : {0, 1, 15, 16, 17, 40, 99, 100})
+    for(auto pos : {0, 1, 7, 31, 32, 33, 64, 98, 99})
+    {
+        auto y = x;
+        y.resize(n);
+
+        if(pos < n)
+        {
+            y[pos] = static_cast<Value>(y[pos] ^ Value(1) << (sizeof(Value) * CHAR_BIT - 1));
+        }
+
+        auto const r_ural = ural::mismatch(x, y);
+        auto const n_common = std::min(x.size(), y.size());
+        auto const r_std = std::mismatch(x.begin(), x.begin() + n_common, y.begin());
+
+        BOOST_CHECK(r_ural[ural::_1].begin() == r_std.first);
+        BOOST_CHECK(r_ural[ural::_2].begin() == r_std.second);
+        BOOST_CHECK(r_ural[ural::_1].traversed_begin() == x.begin());
+
+        BOOST_CHECK_EQUAL(ural::equal(x, y), x == y);
+        BOOST_CHECK_EQUAL(ural::equal(y, x), x == y);
+    }
+}
+
 // 25.2.12
 BOOST_AUTO_TEST_CASE(is_permutation_test)
 {
@@ -367,6 +603,120 @@ BOOST_AUTO_TEST_CASE(is_permutation_regression_47)
     BOOST_CHECK(!ural::is_permutation(s1, s2));
 }
 
+namespace
+{
+    // Тип без хэш-функции и без оператора "меньше"
+    struct is_permutation_test_type
+    {
+        int value;
+
+        friend bool operator==(is_permutation_test_type const & x,
+                               is_permutation_test_type const & y)
+        {
+            return x.value == y.value;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_CASE(is_permutation_test_strategies)
+{
+    using ural::details::is_permutation_strategy;
+    typedef ural::cursor_type_t<std::vector<int> const &> Ints;
+    typedef ural::cursor_type_t<std::vector<double> const &> Doubles;
+    typedef ural::cursor_type_t<std::vector<is_permutation_test_type> const &> Structs;
+    typedef ural::equal_to<> Equal;
+
+    static_assert(std::is_same<typename is_permutation_strategy<Ints, Ints, Equal>::type,
+                               ural::details::permutation_by_sorting_tag>::value, "");
+    static_assert(std::is_same<typename is_permutation_strategy<Doubles, Doubles, Equal>::type,
+                               ural::details::permutation_by_hashing_tag>::value, "");
+    static_assert(std::is_same<typename is_permutation_strategy<Structs, Structs, Equal>::type,
+                               ural::details::permutation_by_counting_tag>::value, "");
+    static_assert(std::is_same<typename is_permutation_strategy<Ints, Doubles, Equal>::type,
+                               ural::details::permutation_by_counting_tag>::value, "");
+
+    BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE(is_permutation_test_large)
+{
+    std::vector<int> x;
+
+    for(auto i = 0; i < 1000; ++ i)
+    {
+        x.push_back(i % 37);
+    }
+
+    auto y = x;
+    std::reverse(y.begin(), y.end());
+    std::list<int> const y_list(y.begin(), y.end());
+
+    BOOST_CHECK(ural::is_permutation(x, y));
+    BOOST_CHECK(ural::is_permutation(x, y_list));
+    BOOST_CHECK(ural::is_permutation(y_list, x));
+
+    y.back() += 1;
+
+    BOOST_CHECK(!ural::is_permutation(x, y));
+    BOOST_CHECK(!ural::is_permutation(y, x));
+
+    std::vector<std::string> const s1{"one", "two", "three", "two"};
+    std::vector<std::string> const s2{"two", "three", "two", "one"};
+    std::vector<std::string> const s3{"two", "three", "one", "one"};
+
+    BOOST_CHECK(ural::is_permutation(s1, s2));
+    BOOST_CHECK(!ural::is_permutation(s1, s3));
+}
+
+BOOST_AUTO_TEST_CASE(is_permutation_test_hash)
+{
+    std::vector<double> const x{1.5, 0.0, 2.5, 1.5, -3.0};
+    std::list<double> const y{-3.0, 1.5, 2.5, -0.0, 1.5};
+    std::list<double> const z{-3.0, 1.5, 2.5, 0.0, 2.5};
+
+    BOOST_CHECK(ural::is_permutation(x, y));
+    BOOST_CHECK(!ural::is_permutation(x, z));
+
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> const with_nan{1.0, nan};
+
+    BOOST_CHECK(!ural::is_permutation(with_nan, with_nan));
+}
+
+BOOST_AUTO_TEST_CASE(is_permutation_test_no_hash_no_less)
+{
+    typedef is_permutation_test_type T;
+
+    std::vector<T> const x{{1}, {2}, {2}, {3}};
+    std::list<T> const y{{2}, {3}, {2}, {1}};
+    std::list<T> const z{{2}, {3}, {1}, {1}};
+
+    BOOST_CHECK(ural::is_permutation(x, y));
+    BOOST_CHECK(!ural::is_permutation(x, z));
+}
+
+BOOST_AUTO_TEST_CASE(is_permutation_test_buffer)
+{
+    std::string const x = "Hello, World";
+    std::forward_list<char> const y = {'w', 'o', 'R', 'L', 'd', ',', ' ',
+                                       'h', 'E', 'l', 'L', 'O'};
+    std::string const z = "Hello, Worlds";
+
+    auto const cmp = [](char a, char b) { return std::tolower(a) < std::tolower(b); };
+
+    std::vector<char> buffer(2 * x.size());
+    std::vector<char> small_buffer(3);
+
+    BOOST_CHECK(ural::is_permutation(x, y, buffer, cmp));
+    BOOST_CHECK(ural::is_permutation(y, x, buffer, cmp));
+    BOOST_CHECK(ural::is_permutation(x, y, small_buffer, cmp));
+    BOOST_CHECK(!ural::is_permutation(x, z, buffer, cmp));
+    BOOST_CHECK(!ural::is_permutation(x, y, buffer, ural::less<>{}));
+    BOOST_CHECK(!ural::is_permutation(x, y, small_buffer, ural::less<>{}));
+
+    BOOST_CHECK(!ural::is_permutation(x, y));
+}
+
 // 25.2.13
 BOOST_AUTO_TEST_CASE(search_test)
 {
@@ -387,6 +737,111 @@ BOOST_AUTO_TEST_CASE(search_test)
     BOOST_CHECK_EQUAL(Inner::in_quote(str, s2), !!ural::search(str, s2));
 }
 
+namespace
+{
+    // Набор строк над малым алфавитом: много частичных совпадений
+    std::vector<std::string> make_search_test_strings()
+    {
+        std::vector<std::string> result = {"", "a", "ab", "aaaa", "abab",
+                                           "abaabaab", "aabaaabaaaab"};
+
+        std::string s;
+        for(auto i = 0; i < 200; ++ i)
+        {
+            s.push_back("aab"[(i * i + 3 * i) % 7 % 3]);
+        }
+
+        result.push_back(s);
+
+        for(auto const & len : {1, 2, 3, 5, 8, 13})
+        {
+            for(auto const & pos : {0, 17, 100, 200 - len})
+            {
+                result.push_back(s.substr(pos, len));
+            }
+        }
+
+        return result;
+    }
+
+    template <class MakeSearcher>
+    void check_searcher(MakeSearcher make)
+    {
+        auto const strings = make_search_test_strings();
+
+        for(auto const & text : strings)
+        for(auto const & pattern : strings)
+        {
+            auto const expected = std::search(text.begin(), text.end(),
+                                              pattern.begin(), pattern.end());
+
+            auto const r = ural::search(text, make(pattern));
+
+            BOOST_CHECK(r.begin() == expected);
+            BOOST_CHECK(r.end() == text.end());
+            BOOST_CHECK(r.traversed_begin() == text.begin());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(search_test_boyer_moore_horspool_searcher)
+{
+    check_searcher([](std::string const & p)
+                   { return ural::make_boyer_moore_horspool_searcher(p); });
+}
+
+BOOST_AUTO_TEST_CASE(search_test_boyer_moore_searcher)
+{
+    check_searcher([](std::string const & p)
+                   { return ural::make_boyer_moore_searcher(p); });
+}
+
+BOOST_AUTO_TEST_CASE(search_test_two_way_searcher)
+{
+    check_searcher([](std::string const & p)
+                   { return ural::make_two_way_searcher(p); });
+}
+
+BOOST_AUTO_TEST_CASE(search_test_searchers_non_byte_values)
+{
+    std::vector<long> const text = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3, 2, 3};
+    std::vector<long> const pattern = {5, 3, 5};
+
+    auto const expected = std::search(text.begin(), text.end(),
+                                      pattern.begin(), pattern.end());
+
+    BOOST_CHECK(ural::search(text, ural::make_boyer_moore_searcher(pattern)).begin()
+                == expected);
+    BOOST_CHECK(ural::search(text, ural::make_boyer_moore_horspool_searcher(pattern)).begin()
+                == expected);
+    BOOST_CHECK(ural::search(text, ural::make_two_way_searcher(pattern)).begin()
+                == expected);
+}
+
+BOOST_AUTO_TEST_CASE(search_test_strings_and_find_end)
+{
+    auto const strings = make_search_test_strings();
+
+    for(auto const & text : strings)
+    for(auto const & pattern : strings)
+    {
+        auto const expected = std::search(text.begin(), text.end(),
+                                          pattern.begin(), pattern.end());
+        BOOST_CHECK(ural::search(text, pattern).begin() == expected);
+
+        // Для пустого образца ural::find_end не продвигает последовательность
+        auto const expected_end
+            = pattern.empty() ? text.begin()
+                              : std::find_end(text.begin(), text.end(),
+                                              pattern.begin(), pattern.end());
+        auto const r = ural::find_end(text, pattern);
+
+        BOOST_CHECK(r.begin() == expected_end);
+        BOOST_CHECK(r.end() == text.end());
+        BOOST_CHECK(r.traversed_begin() == text.begin());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(search_n_test)
 {
     const std::string xs = "1001010100010101001010101";
@@ -398,6 +853,58 @@ BOOST_AUTO_TEST_CASE(search_n_test)
     }
 }
 
+BOOST_AUTO_TEST_CASE(search_n_test_random_access)
+{
+    std::uniform_int_distribution<int> d(0, 9);
+
+    for(auto density : {2, 5, 9})
+    {
+        std::vector<int> xs(300);
+
+        for(auto & x : xs)
+        {
+            x = d(ural_test::random_engine()) < density ? 0 : 1;
+        }
+
+        std::list<int> const ys(xs.begin(), xs.end());
+
+        for(auto n : {-1, 0, 1, 2, 3, 4, 7, 12, 299, 300, 301})
+        {
+            auto const r_std = std::search_n(xs.begin(), xs.end(), n, 0);
+            auto const r_ural = ural::search_n(xs, n, 0);
+            auto const r_list = ural::search_n(ys, n, 0);
+
+            if(n >= 0)
+            {
+                BOOST_CHECK(r_ural.begin() == r_std);
+            }
+
+            BOOST_CHECK(r_ural.end() == xs.end());
+            BOOST_CHECK_EQUAL(r_ural.size(), ural::size(r_list));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(search_n_test_long_run)
+{
+    std::vector<unsigned char> data(1 << 16, 1);
+
+    std::fill(data.begin() + 1000, data.begin() + 1000 + 4095, 0);
+    std::fill(data.begin() + 20000, data.begin() + 20000 + 4096, 0);
+
+    std::size_t probes = 0;
+    auto const pred = [&probes](unsigned char x, unsigned char y)
+    {
+        ++ probes;
+        return x == y;
+    };
+
+    auto const r = ural::search_n(data, 4096, 0, pred);
+
+    BOOST_CHECK(r.begin() == data.begin() + 20000);
+    BOOST_CHECK_LT(probes, 2 * 4096 + 4096 + data.size() / 4096);
+}
+
 // find_first_not_of
 BOOST_AUTO_TEST_CASE(find_first_not_of_test)
 {
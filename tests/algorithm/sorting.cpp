@@ -1,1369 +1,2503 @@
-/*  This file is part of Ural.
-
-    Ural is free software: you can redistribute it and/or modify
-    it under the terms of the GNU General Public License as published by
-    the Free Software Foundation, either version 3 of the License, or
-    (at your option) any later version.
-
-    Ural is distributed in the hope that it will be useful,
-    but WITHOUT ANY WARRANTY; without even the implied warranty of
-    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-    GNU General Public License for more details.
-
-    You should have received a copy of the GNU General Public License
-    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
-*/
-
-#include <ural/algorithm.hpp>
-
-#include "../defs.hpp"
-
-#include <ural/container/vector.hpp>
-#include <ural/numeric/numbers_sequence.hpp>
-#include <ural/sequence/adaptors/cartesian_product.hpp>
-#include <ural/utility/tracers.hpp>
-
-#include <forward_list>
-#include <forward_list>
-#include <list>
-#include <vector>
-
-#include <boost/mpl/list.hpp>
-#include <boost/test/unit_test.hpp>
-
-namespace
-{
-    namespace ural_ex = ::ural::experimental;
-
-    typedef boost::mpl::list<std::forward_list<int>,
-                             std::list<int>,
-                             std::vector<int>,
-                             ural_test::istringstream_helper<int>> Sources;
-}
-
-// 25.4 Сортировка и связанные с ней операции
-// 25.4.1 Сортировка
-BOOST_AUTO_TEST_CASE(sort_test)
-{
-    std::vector<int> x_std = {5, 7, 4, 2, 8, 6, 1, 9, 0, 3};
-    auto x_ural = x_std;
-
-    std::sort(x_std.begin(), x_std.end());
-    auto const result = ural::sort(x_ural);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-
-    BOOST_CHECK(!result);
-    BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
-}
-
-namespace
-{
-    struct Double_compared_by_integral_part
-    {
-        double value;
-
-        Double_compared_by_integral_part(double x)
-         : value{x}
-        {}
-
-        bool operator<(Double_compared_by_integral_part const & that) const
-        {
-            return int(this->value) < int(that.value);
-        }
-
-        bool operator!=(Double_compared_by_integral_part const & that) const
-        {
-            return this->value != that.value;
-        }
-
-    friend std::ostream & operator<<(std::ostream & os, Double_compared_by_integral_part x)
-    {
-        return os << x.value;
-    }
-    };
-}
-
-BOOST_AUTO_TEST_CASE(stable_sort_test)
-{
-    std::vector<Double_compared_by_integral_part> x_std
-        = {3.14, 1.41, 2.72, 4.67, 1.73, 1.32, 1.62, 2.58};
-    auto x_ural = x_std;
-
-    std::stable_sort(x_std.begin(), x_std.end());
-    auto const result = ural::stable_sort(x_ural);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-
-    BOOST_CHECK(!result);
-    BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
-}
-
-BOOST_AUTO_TEST_CASE(partial_sort_test)
-{
-    std::array<int, 10> const xs {5, 7, 4, 2, 8, 6, 1, 9, 0, 3};
-    auto ys = xs;
-
-    auto const part = 3;
-
-    auto const result = ural::partial_sort(ys, part);
-
-    BOOST_CHECK(std::is_sorted(ys.begin(), ys.begin() + part));
-    BOOST_CHECK(ural::is_permutation(xs, ys));
-    BOOST_CHECK(std::all_of(ys.begin() + part, ys.end(),
-                            [=](int x) {return x >= ys[2];}));
-
-    BOOST_CHECK(result.begin() == ys.end());
-    BOOST_CHECK(result.end()   == ys.end());
-    BOOST_CHECK(result.traversed_front().begin() == ys.begin());
-    BOOST_CHECK(result.traversed_front().end()   == ys.end());
-}
-
-BOOST_AUTO_TEST_CASE(partial_sort_reversed_test)
-{
-    std::array<int, 10> const ys {5, 7, 4, 2, 8, 6, 1, 9, 0, 3};
-
-    auto xs = ys;
-
-    ural::partial_sort(xs | ural_ex::reversed, xs.size());
-
-    BOOST_CHECK(std::is_sorted(xs.rbegin(), xs.rend()));
-    BOOST_CHECK(ural::is_permutation(xs, ys));
-}
-
-BOOST_AUTO_TEST_CASE(partial_sort_copy_test)
-{
-    std::list<int> const src{4, 2, 5, 1, 3};
-
-    std::vector<int> r1_std{10, 11, 12};
-    std::vector<int> r1_ural{10, 11, 12};
-
-    auto pos_std = std::partial_sort_copy(src.begin(), src.end(),
-                                          r1_std.begin(), r1_std.end());
-    auto pos_ural = ural::partial_sort_copy(src, r1_ural);
-
-    BOOST_CHECK(pos_ural.original() == ural::cursor(r1_ural));
-    BOOST_CHECK_EQUAL(r1_std.end() - pos_std, pos_ural.size());
-    BOOST_CHECK_EQUAL(pos_std - r1_std.begin(), pos_ural.traversed_front().size());
-
-    URAL_CHECK_EQUAL_RANGES(r1_std, r1_ural);
-}
-
-BOOST_AUTO_TEST_CASE(partial_sort_copy_test_custom_predicate_to_greater)
-{
-    std::list<int> const src{4, 2, 5, 1, 3};
-
-    std::vector<int> r2_std{10, 11, 12, 13, 14, 15, 16};
-    std::vector<int> r2_ural{10, 11, 12, 13, 14, 15, 16};
-
-    auto pos_std = std::partial_sort_copy(src.begin(), src.end(),
-                                     r2_std.begin(), r2_std.end(),
-                                     std::greater<int>());
-    auto pos_ural = ural::partial_sort_copy(src, r2_ural, ural::greater<>());
-
-    BOOST_CHECK(pos_ural.original() == ural::cursor(r2_ural));
-    BOOST_CHECK_EQUAL(r2_std.end() - pos_std, pos_ural.size());
-    BOOST_CHECK_EQUAL(pos_std - r2_std.begin(), pos_ural.traversed_front().size());
-
-    URAL_CHECK_EQUAL_RANGES(r2_std, r2_ural);
-}
-
-BOOST_AUTO_TEST_CASE(is_sorted_test)
-{
-    std::vector<int> digits {3, 1, 4, 1, 5};
-
-    BOOST_CHECK_EQUAL(false, ural::is_sorted(digits));
-    BOOST_CHECK_EQUAL(std::is_sorted(digits.begin(), digits.end()),
-                      ural::is_sorted(digits));
-
-    std::sort(digits.begin(), digits.end());
-
-    BOOST_CHECK_EQUAL(true, std::is_sorted(digits.begin(), digits.end()));
-    BOOST_CHECK_EQUAL(true, ural::is_sorted(digits));
-}
-
-BOOST_AUTO_TEST_CASE(is_sorted_until_test)
-{
-    std::vector<int> nums = {1, 3, 4, 5, 9};
-
-    do
-    {
-        auto result_std = std::is_sorted_until(nums.begin(), nums.end());
-        auto result_ural = ural::is_sorted_until(nums);
-
-        BOOST_CHECK(result_ural.original() == ural::cursor(nums));
-        BOOST_CHECK(result_ural.begin() == result_std);
-        BOOST_CHECK(result_ural.end() == nums.end());
-    }
-    while(std::next_permutation(nums.begin(), nums.end()));
-}
-
-BOOST_AUTO_TEST_CASE(nth_element_test)
-{
-    std::vector<int> x_std{5, 6, 4, 3, 2, 6, 7, 9, 3};
-    auto x_ural = x_std;
-
-    auto const pos_1 = x_std.size() / 2;
-
-    std::nth_element(x_std.begin(), x_std.begin() + pos_1, x_std.end());
-
-    auto s_std = ural::cursor(x_std) + pos_1;
-    auto s_ural = ural::cursor(x_ural) + pos_1;
-
-    auto result = ural::nth_element(s_ural);
-
-    BOOST_CHECK(ural::is_permutation(x_std, x_ural));
-    BOOST_CHECK_EQUAL(x_std[pos_1], x_ural[pos_1]);
-
-    BOOST_CHECK(ural::is_permutation(s_std, s_ural));
-    BOOST_CHECK(ural::is_permutation(s_std.traversed_front(),
-                                     s_ural.traversed_front()));
-
-    BOOST_CHECK(result.begin() == x_ural.end());
-    BOOST_CHECK(result.end()   == x_ural.end());
-    BOOST_CHECK(result.traversed_front().begin() == x_ural.begin());
-    BOOST_CHECK(result.traversed_front().end()   == x_ural.end());
-}
-
-// 25.4.3 Бинарный поиск
-BOOST_AUTO_TEST_CASE(lower_bound_test)
-{
-    std::vector<int> const data = { 1, 1, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 6 };
-    auto const value = 4;
-
-    auto r_std = std::lower_bound(data.begin(), data.end(), value);
-    auto r_ural = ural::lower_bound(data, value);
-
-    BOOST_CHECK(!!r_ural);
-    BOOST_CHECK_EQUAL(*r_std, *r_ural);
-
-    BOOST_CHECK(data.begin() == r_ural.traversed_begin());
-    BOOST_CHECK(r_std == r_ural.begin());
-    BOOST_CHECK(data.end() == r_ural.end());
-    BOOST_CHECK(data.end() == r_ural.traversed_end());
-}
-
-BOOST_AUTO_TEST_CASE(upper_bound_test)
-{
-    std::vector<int> const data = { 1, 1, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 6 };
-    auto const value = 4;
-
-    auto r_std = std::upper_bound(data.begin(), data.end(), value);
-    auto r_ural = ural::upper_bound(data, value);
-
-    BOOST_CHECK(!!r_ural);
-    BOOST_CHECK_EQUAL(*r_std, *r_ural);
-
-    BOOST_CHECK(data.begin() == r_ural.traversed_begin());
-    BOOST_CHECK(r_std == r_ural.begin());
-    BOOST_CHECK(data.end() == r_ural.end());
-    BOOST_CHECK(data.end() == r_ural.traversed_end());
-}
-
-BOOST_AUTO_TEST_CASE(equal_range_test)
-{
-    auto const src = []()
-    {
-        std::vector<int> v = {10,20,30,30,20,10,10,20};
-        std::sort (v.begin(), v.end());
-        return v;
-    }();
-
-    auto const value = 20;
-
-    auto r_std = std::equal_range (src.begin(), src.end(), value);
-    auto r_ural = ural::equal_range(src, value);
-
-    BOOST_CHECK(r_std.first == r_ural.begin());
-    BOOST_CHECK_EQUAL(r_std.second - r_std.first,
-                      r_ural.end() - r_ural.begin());
-    BOOST_CHECK(src.begin() == r_ural.traversed_begin());
-    BOOST_CHECK(src.end() == r_ural.traversed_end());
-}
-
-BOOST_AUTO_TEST_CASE(equal_range_different_traversed_front)
-{
-    auto const s1 = ural::numbers(1, 9);
-    auto const s2 = ural::numbers(0, 9);
-
-    auto const s = ural_ex::make_cartesian_product_cursor(s1, s2);
-
-    static_assert(!std::is_same<decltype(s), decltype(s.traversed_front())>::value, "");
-
-    assert(ural::is_sorted(s));
-
-    auto const needle = ural::value_type_t<decltype(s)>{4, 2};
-
-    auto pos = ural::equal_range(s, needle);
-
-    assert(!!pos);
-    BOOST_CHECK(*pos == needle);
-    BOOST_CHECK_EQUAL(ural::size(pos), 1);
-
-    BOOST_CHECK(pos.base().original() == s);
-
-    assert(!!pos.traversed_front());
-    BOOST_CHECK(pos.traversed_front().front() == s.front());
-}
-
-BOOST_AUTO_TEST_CASE(binary_search_test)
-{
-    std::vector<int> const haystack {1, 3, 4, 5, 9};
-    std::vector<int> const needles {1, 2, 3, 10};
-
-    for (auto needle : needles)
-    {
-        auto r_std = std::binary_search(haystack.begin(), haystack.end(), needle);
-        auto r_ural = ural::binary_search(haystack, needle);
-
-        BOOST_CHECK_EQUAL(r_std, r_ural);
-    }
-}
-
-// 25.4.4 Слияние
-BOOST_AUTO_TEST_CASE(merge_test)
-{
-    // Исходные данные
-    std::vector<int> const v1{1,2,3,4,5,6,7,8};
-    std::vector<int> const v2{        5,  7,  9,10};
-
-    // std
-    std::vector<int> std_merge;
-    std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
-               std::back_inserter(std_merge));
-
-    // ural
-    std::vector<int> ural_merge;
-    ural::merge(v1, v2, ural_merge | ural::back_inserter);
-
-    // Проверка
-    URAL_CHECK_EQUAL_RANGES(std_merge, ural_merge);
-}
-
-BOOST_AUTO_TEST_CASE(merge_test_lesser_in_1)
-{
-    // Исходные данные
-    std::vector<int> const v1{1,2,3,4,5,6,7,8};
-    std::vector<int> const v2{        5,  7,  9,10};
-
-    BOOST_CHECK_LE(v1.back(), v2.back());
-
-    // std
-    std::vector<int> std_merge;
-    std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
-               std::back_inserter(std_merge));
-
-    // ural
-    std::vector<int> ural_merge(v1.size() + v2.size() + 3, - 1);
-    auto const ural_merge_old = ural_merge;
-
-    auto const result = ural::merge(v1, v2, ural_merge);
-
-    BOOST_CHECK(!result[ural::_1]);
-    BOOST_CHECK(!result[ural::_2]);
-    BOOST_CHECK(!!result[ural::_3]);
-
-    BOOST_CHECK(result[ural::_1].original() == ural::cursor(v1));
-    BOOST_CHECK(result[ural::_2].original() == ural::cursor(v2));
-    BOOST_CHECK(result[ural::_3].original() == ural::cursor(ural_merge));
-
-    BOOST_CHECK(result[ural::_3].begin() == ural_merge.begin() + std_merge.size());
-
-    // Проверка
-    BOOST_CHECK_EQUAL_COLLECTIONS(std_merge.begin(), std_merge.end(),
-                                  ural_merge.begin(), result[ural::_3].begin());
-    BOOST_CHECK_EQUAL_COLLECTIONS(result[ural::_3].begin(), result[ural::_3].end(),
-                                  ural_merge_old.begin() + std_merge.size(),
-                                  ural_merge_old.end());
-}
-
-BOOST_AUTO_TEST_CASE(merge_test_lesser_in_2)
-{
-    // Исходные данные
-    std::vector<int> const v1{1,2,3,4,5,6,7,8,     11};
-    std::vector<int> const v2{        5,  7,  9,10};
-
-    BOOST_CHECK_GE(v1.back(), v2.back());
-
-    // std
-    std::vector<int> std_merge;
-    std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
-               std::back_inserter(std_merge));
-
-    // ural
-    std::vector<int> ural_merge(v1.size() + v2.size() + 3, - 1);
-    auto const ural_merge_old = ural_merge;
-
-    auto const result = ural::merge(v1, v2, ural_merge);
-
-    BOOST_CHECK(!result[ural::_1]);
-    BOOST_CHECK(!result[ural::_2]);
-    BOOST_CHECK(!!result[ural::_3]);
-
-    BOOST_CHECK(result[ural::_1].original() == ural::cursor(v1));
-    BOOST_CHECK(result[ural::_2].original() == ural::cursor(v2));
-    BOOST_CHECK(result[ural::_3].original() == ural::cursor(ural_merge));
-
-    BOOST_CHECK(result[ural::_3].begin() == ural_merge.begin() + std_merge.size());
-
-    // Проверка
-    BOOST_CHECK_EQUAL_COLLECTIONS(std_merge.begin(), std_merge.end(),
-                                  ural_merge.begin(), result[ural::_3].begin());
-    BOOST_CHECK_EQUAL_COLLECTIONS(result[ural::_3].begin(), result[ural::_3].end(),
-                                  ural_merge_old.begin() + std_merge.size(),
-                                  ural_merge_old.end());
-}
-
-BOOST_AUTO_TEST_CASE(merge_test_exhaust_out)
-{
-    // Исходные данные
-    std::vector<int> const v1{1,2,3,4,5,6,7,8,     11};
-    std::vector<int> const v2{        5,  7,  9,10};
-
-    // ural
-    std::vector<int> ural_merge((v1.size() + v2.size()) / 2, - 1);
-
-    auto const result = ural::merge(v1, v2, ural_merge);
-
-    BOOST_CHECK(!!result[ural::_1]);
-    BOOST_CHECK(!!result[ural::_2]);
-    BOOST_CHECK(!result[ural::_3]);
-
-    BOOST_CHECK(result[ural::_1].original() == ural::cursor(v1));
-    BOOST_CHECK(result[ural::_2].original() == ural::cursor(v2));
-    BOOST_CHECK(result[ural::_3].original() == ural::cursor(ural_merge));
-
-    BOOST_CHECK(!result[ural::_1].traversed_back());
-    BOOST_CHECK(!result[ural::_2].traversed_back());
-
-    // std
-    std::vector<int> std_merge;
-    std::merge(result[ural::_1].traversed_begin(),
-               result[ural::_1].begin(),
-               result[ural::_2].traversed_begin(),
-               result[ural::_2].begin(),
-               std::back_inserter(std_merge));
-
-    // Проверка
-    URAL_CHECK_EQUAL_RANGES(ural_merge, std_merge);
-}
-
-BOOST_AUTO_TEST_CASE(merge_test_minimalistic)
-{
-    // Исходные данные
-    std::istringstream is1("1 2 3 4 5 6 7 8");
-    std::istringstream is2("        5   7 9 10");
-
-    std::istringstream is1_ural("1 2 3 4 5 6 7 8");
-    std::istringstream is2_ural("        5   7 9 10");
-
-    // std
-    std::vector<int> std_merge;
-    std::merge(std::istream_iterator<int>(is1), std::istream_iterator<int>(),
-               std::istream_iterator<int>(is2), std::istream_iterator<int>(),
-               std::back_inserter(std_merge));
-
-    // ural
-    std::vector<int> ural_merge;
-    ural::merge(ural::experimental::make_istream_cursor<int>(is1_ural),
-                ural::experimental::make_istream_cursor<int>(is2_ural),
-                ural_merge | ural::back_inserter);
-
-    // Проверка
-    URAL_CHECK_EQUAL_RANGES(std_merge, ural_merge);
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_test_empty)
-{
-    std::vector<int> x_std{};
-    auto x_ural = x_std;
-
-    auto pos = x_std.size() / 2;
-
-    std::inplace_merge(x_std.begin(), x_std.begin() + pos, x_std.end());
-
-    auto s = ::ural::cursor(x_ural);
-    s += pos;
-    auto result = ural::inplace_merge(s);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-
-    BOOST_CHECK(result.begin() == x_ural.end());
-    BOOST_CHECK(result.end()   == x_ural.end());
-    BOOST_CHECK(result.traversed_front().begin() == x_ural.begin());
-    BOOST_CHECK(result.traversed_front().end()   == x_ural.end());
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_test_1)
-{
-    std::vector<int> x_std{1};
-    auto x_ural = x_std;
-
-    auto pos = x_std.size() / 2;
-
-    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
-                       x_std.end());
-    auto s = ::ural::cursor(x_ural);
-    s += pos;
-    ural::inplace_merge(s);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_test_1_2)
-{
-    std::vector<int> x_std{1, 2};
-    auto x_ural = x_std;
-
-    auto pos = x_std.size() / 2;
-
-    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
-                       x_std.end());
-    auto s = ::ural::cursor(x_ural);
-    s += pos;
-    ural::inplace_merge(s);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_test_2_1)
-{
-    std::vector<int> x_std{2, 1};
-    auto x_ural = x_std;
-
-    auto pos = x_std.size() / 2;
-
-    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
-                       x_std.end());
-    auto s = ::ural::cursor(x_ural);
-    s += pos;
-    ural::inplace_merge(s);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_test_2_1_3)
-{
-    std::vector<int> x_std{3, 1, 2};
-    auto x_ural = x_std;
-
-    auto pos = x_std.size() / 2;
-
-    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
-                       x_std.end());
-    auto s = ::ural::cursor(x_ural);
-    s += pos;
-    ural::inplace_merge(s);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_test_4)
-{
-    std::vector<int> x_std{1, 2, 0, 4};
-    auto x_ural = x_std;
-
-    auto pos = x_std.size() / 2;
-
-    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
-                       x_std.end());
-    auto s = ::ural::cursor(x_ural);
-    s += pos;
-    ural::inplace_merge(s);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_test_10)
-{
-    std::vector<int> x_std{1, 2, 3, 5, 8, 0, 4, 6, 7, 9};
-    auto x_ural = x_std;
-
-    auto pos = x_std.size() / 2;
-
-    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
-                       x_std.end());
-    auto s = ::ural::cursor(x_ural);
-    s += pos;
-    auto result = ural::inplace_merge(s);
-
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-    BOOST_CHECK(result.original() == ural::cursor(x_ural));
-    BOOST_CHECK(!result);
-    BOOST_CHECK(!result.traversed_back());
-}
-
-BOOST_AUTO_TEST_CASE(inplace_merge_minimalistic)
-{
-    std::list<int> x_std{1, 2, 3, 5, 8, 0, 4, 6, 7, 9};
-    auto x_ural = x_std;
-
-    auto const pos =  x_std.size() / 2;
-
-    // std
-    std::inplace_merge(x_std.begin(), std::next(x_std.begin(), pos), x_std.end());
-
-    // ural
-    auto s = ::ural::cursor(x_ural);
-    ural::advance(s, pos);
-    auto result = ural::inplace_merge(s);
-
-    // Сравнение
-    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
-
-    BOOST_CHECK(result.original() == ural::cursor(x_ural));
-    BOOST_CHECK(!result);
-    BOOST_CHECK(!result.traversed_back());
-}
-
-// 25.4.5 Операции со множествами на сортированных структурах
-BOOST_AUTO_TEST_CASE(includes_test)
-{
-    std::vector<std::string> vs{"abcfhx", "abc", "ac", "g", "acg", {}};
-
-    for(auto const & s1 : vs)
-    for(auto const & s2 : vs)
-    {
-        bool const r_std = std::includes(s1.begin(), s1.end(),
-                                         s2.begin(), s2.end());        bool const r_ural = ural::includes(s1, s2);
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <ural/algorithm.hpp>
+
+#include "../defs.hpp"
+#include "../rnd.hpp"
+
+#include <ural/container/vector.hpp>
+#include <ural/numeric/numbers_sequence.hpp>
+#include <ural/sequence/adaptors/cartesian_product.hpp>
+#include <ural/utility/tracers.hpp>
+
+#include <atomic>
+#include <forward_list>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/mpl/list.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+    namespace ural_ex = ::ural::experimental;
+
+    typedef boost::mpl::list<std::forward_list<int>,
+                             std::list<int>,
+                             std::vector<int>,
+                             ural_test::istringstream_helper<int>> Sources;
+}
+
+// 25.4 Сортировка и связанные с ней операции
+// 25.4.1 Сортировка
+BOOST_AUTO_TEST_CASE(sort_test)
+{
+    std::vector<int> x_std = {5, 7, 4, 2, 8, 6, 1, 9, 0, 3};
+    auto x_ural = x_std;
+
+    std::sort(x_std.begin(), x_std.end());
+    auto const result = ural::sort(x_ural);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+
+    BOOST_CHECK(!result);
+    BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+}
+
+BOOST_AUTO_TEST_CASE(sort_test_different_sizes_and_patterns)
+{
+    std::uniform_int_distribution<int> d(0, 100);
+
+    for(auto n : {0, 1, 2, 3, 15, 16, 17, 100, 129, 1000, 10000})
+    {
+        std::vector<int> random_src;
+        std::generate_n(std::back_inserter(random_src), n,
+                        [&]{ return d(ural_test::random_engine()); });
+
+        std::vector<int> organ_pipe(n);
+        for(auto i = 0; i < n; ++ i)
+        {
+            organ_pipe[i] = std::min(i, n - i);
+        }
+
+        auto sorted = random_src;
+        std::sort(sorted.begin(), sorted.end());
+
+        auto reversed = sorted;
+        std::reverse(reversed.begin(), reversed.end());
+
+        for(auto const & src : {random_src, organ_pipe, sorted, reversed,
+                                std::vector<int>(n, 42)})
+        {
+            auto x_std = src;
+            auto x_ural = src;
+
+            std::sort(x_std.begin(), x_std.end());
+            auto const result = ural::sort(x_ural);
+
+            URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+            BOOST_CHECK(!result);
+            BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sort_test_strings_custom_compare_reversed)
+{
+    std::uniform_int_distribution<int> d('a', 'z');
+
+    std::vector<std::string> x_std(1000);
+    for(auto & s : x_std)
+    {
+        std::generate_n(std::back_inserter(s), d(ural_test::random_engine()) % 5,
+                        [&]{ return char(d(ural_test::random_engine())); });
+    }
+    auto x_ural = x_std;
+
+    std::sort(x_std.rbegin(), x_std.rend(), std::greater<>{});
+    ural::sort(x_ural | ural_ex::reversed, ural::greater<>{});
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(pdq_sort_test_different_sizes_and_patterns)
+{
+    std::uniform_int_distribution<int> d(0, 100);
+
+    for(auto n : {0, 1, 2, 3, 23, 24, 25, 100, 129, 1000, 10000})
+    {
+        std::vector<int> random_src;
+        std::generate_n(std::back_inserter(random_src), n,
+                        [&]{ return d(ural_test::random_engine()); });
+
+        std::vector<int> organ_pipe(n);
+        for(auto i = 0; i < n; ++ i)
+        {
+            organ_pipe[i] = std::min(i, n - i);
+        }
+
+        auto sorted = random_src;
+        std::sort(sorted.begin(), sorted.end());
+
+        auto reversed = sorted;
+        std::reverse(reversed.begin(), reversed.end());
+
+        auto nearly_sorted = sorted;
+        for(auto i = 0; i + 10 < n; i += 100)
+        {
+            std::swap(nearly_sorted[i], nearly_sorted[i + 10]);
+        }
+
+        for(auto const & src : {random_src, organ_pipe, sorted, reversed,
+                                nearly_sorted, std::vector<int>(n, 42)})
+        {
+            auto x_std = src;
+            auto x_ural = src;
+
+            std::sort(x_std.begin(), x_std.end());
+            auto const result = ural::pdq_sort(x_ural);
+
+            URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+            BOOST_CHECK(!result);
+            BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pdq_sort_test_greater_double)
+{
+    std::uniform_real_distribution<double> d(-1.0, 1.0);
+
+    std::vector<double> x_std(5000);
+    for(auto & x : x_std)
+    {
+        x = d(ural_test::random_engine());
+    }
+    auto x_ural = x_std;
+
+    std::sort(x_std.begin(), x_std.end(), std::greater<>{});
+    ural::pdq_sort(x_ural, ural::greater<>{});
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(pdq_sort_test_strings_custom_compare_reversed)
+{
+    std::uniform_int_distribution<int> d('a', 'z');
+
+    std::vector<std::string> x_std(1000);
+    for(auto & s : x_std)
+    {
+        std::generate_n(std::back_inserter(s), d(ural_test::random_engine()) % 5,
+                        [&]{ return char(d(ural_test::random_engine())); });
+    }
+    auto x_ural = x_std;
+
+    auto const cmp = [](std::string const & x, std::string const & y)
+                     { return x.size() < y.size() || (x.size() == y.size() && x < y); };
+
+    std::sort(x_std.rbegin(), x_std.rend(), cmp);
+    ural::pdq_sort(x_ural | ural_ex::reversed, cmp);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+namespace
+{
+    struct Double_compared_by_integral_part
+    {
+        double value;
+
+        Double_compared_by_integral_part(double x)
+         : value{x}
+        {}
+
+        bool operator<(Double_compared_by_integral_part const & that) const
+        {
+            return int(this->value) < int(that.value);
+        }
+
+        bool operator!=(Double_compared_by_integral_part const & that) const
+        {
+            return this->value != that.value;
+        }
+
+    friend std::ostream & operator<<(std::ostream & os, Double_compared_by_integral_part x)
+    {
+        return os << x.value;
+    }
+    };
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_integers_test)
+{
+    std::uniform_int_distribution<std::uint64_t> d_u64;
+    std::uniform_int_distribution<int> d_int(-1000, 1000);
+
+    for(auto n : {0, 1, 2, 100, 10000})
+    {
+        std::vector<std::uint64_t> x_std;
+        std::generate_n(std::back_inserter(x_std), n,
+                        [&]{ return d_u64(ural_test::random_engine()); });
+        auto x_ural = x_std;
+
+        std::sort(x_std.begin(), x_std.end());
+        auto const result = ural::radix_sort(x_ural);
+
+        BOOST_CHECK(x_std == x_ural);
+        BOOST_CHECK(!result);
+        BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+
+        std::vector<int> y_std;
+        std::generate_n(std::back_inserter(y_std), n,
+                        [&]{ return d_int(ural_test::random_engine()); });
+        auto y_ural = y_std;
+
+        std::sort(y_std.begin(), y_std.end());
+        ural::radix_sort(y_ural);
+
+        BOOST_CHECK(y_std == y_ural);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_floating_point_test)
+{
+    std::vector<double> x_std = {3.5, -0.25, 0.0, -1e300, 1e-300, -7.0,
+                                 1e300, 2.0, -2.0, 0.5, -1e-300};
+    std::uniform_real_distribution<double> d(-1e6, 1e6);
+    std::generate_n(std::back_inserter(x_std), 1000,
+                    [&]{ return d(ural_test::random_engine()); });
+
+    std::vector<float> y_std(x_std.begin(), x_std.end());
+
+    auto x_ural = x_std;
+    auto y_ural = y_std;
+
+    std::sort(x_std.begin(), x_std.end());
+    std::sort(y_std.begin(), y_std.end());
+
+    ural::radix_sort(x_ural);
+    ural::radix_sort(y_ural);
+
+    BOOST_CHECK(x_std == x_ural);
+    BOOST_CHECK(y_std == y_ural);
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_key_function_is_stable_test)
+{
+    // Ключ --- первый элемент, второй хранит исходную позицию
+    using Value = std::pair<int, int>;
+
+    std::uniform_int_distribution<int> d(-50, 50);
+
+    std::vector<Value> x_std;
+    for(auto i = 0; i < 5000; ++ i)
+    {
+        x_std.emplace_back(d(ural_test::random_engine()), i);
+    }
+    auto x_ural = x_std;
+
+    std::stable_sort(x_std.begin(), x_std.end(),
+                     [](Value const & x, Value const & y)
+                     { return x.first < y.first; });
+    ural::radix_sort(x_ural, &Value::first);
+
+    BOOST_CHECK(x_std == x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_bool_key_test)
+{
+    using Value = std::pair<bool, int>;
+
+    std::bernoulli_distribution d(0.5);
+
+    std::vector<Value> x_std;
+    for(auto i = 0; i < 1000; ++ i)
+    {
+        x_std.emplace_back(d(ural_test::random_engine()), i);
+    }
+    auto x_ural = x_std;
+
+    std::stable_sort(x_std.begin(), x_std.end(),
+                     [](Value const & x, Value const & y)
+                     { return x.first < y.first; });
+    ural::radix_sort(x_ural, &Value::first);
+
+    BOOST_CHECK(x_std == x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_enum_test)
+{
+    enum class Color : short { red = -5, green = 0, blue = 7 };
+
+    std::vector<Color> const src{Color::blue, Color::red, Color::green,
+                                 Color::red, Color::blue, Color::green};
+
+    auto x_std = src;
+    auto x_ural = src;
+
+    std::stable_sort(x_std.begin(), x_std.end());
+    ural::radix_sort(x_ural);
+
+    BOOST_CHECK(x_std == x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_strings_test)
+{
+    std::uniform_int_distribution<int> d_length(0, 12);
+    std::uniform_int_distribution<int> d_char('a', 'd');
+
+    std::vector<std::string> x_std(5000);
+    for(auto & s : x_std)
+    {
+        std::generate_n(std::back_inserter(s), d_length(ural_test::random_engine()),
+                        [&]{ return char(d_char(ural_test::random_engine())); });
+    }
+    // Строки с общим длинным префиксом и байтами больше 127
+    x_std.push_back(std::string(100, 'x') + "b");
+    x_std.push_back(std::string(100, 'x') + "a");
+    x_std.push_back(std::string(100, 'x'));
+    x_std.push_back("\xFF");
+    x_std.push_back("\x7F");
+
+    auto x_ural = x_std;
+
+    std::sort(x_std.begin(), x_std.end(),
+              [](std::string const & x, std::string const & y)
+              { return std::lexicographical_compare(x.begin(), x.end(),
+                                                    y.begin(), y.end(),
+                                                    [](char a, char b)
+              { return static_cast<unsigned char>(a) < static_cast<unsigned char>(b); }); });
+
+    auto const result = ural::radix_sort(x_ural);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+    BOOST_CHECK(!result);
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_strings_comb_test)
+{
+    // Каждая строка --- префикс всех более длинных: без обработки самой
+    // большой корзины в цикле глубина рекурсии растёт как N
+    std::vector<std::string> x_std;
+    for(auto i = 0; i < 3000; ++ i)
+    {
+        x_std.push_back(std::string(i, 'a') + 'b');
+    }
+
+    std::shuffle(x_std.begin(), x_std.end(), ural_test::random_engine());
+
+    auto x_ural = x_std;
+
+    std::sort(x_std.begin(), x_std.end());
+    ural::radix_sort(x_ural);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(stable_sort_test)
+{
+    std::vector<Double_compared_by_integral_part> x_std
+        = {3.14, 1.41, 2.72, 4.67, 1.73, 1.32, 1.62, 2.58};
+    auto x_ural = x_std;
+
+    std::stable_sort(x_std.begin(), x_std.end());
+    auto const result = ural::stable_sort(x_ural);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+
+    BOOST_CHECK(!result);
+    BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+}
+
+BOOST_AUTO_TEST_CASE(stable_sort_test_different_sizes_and_patterns)
+{
+    // Ключ --- первый элемент, второй хранит исходную позицию
+    using Value = std::pair<int, int>;
+    auto const cmp = [](Value const & x, Value const & y)
+                     { return x.first < y.first; };
+
+    std::uniform_int_distribution<int> d(0, 20);
+
+    for(auto n : {0, 1, 2, 3, 31, 32, 33, 100, 1000, 10000})
+    {
+        std::vector<int> random_keys;
+        std::generate_n(std::back_inserter(random_keys), n,
+                        [&]{ return d(ural_test::random_engine()); });
+
+        auto sorted_keys = random_keys;
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+
+        auto reversed_keys = sorted_keys;
+        std::reverse(reversed_keys.begin(), reversed_keys.end());
+
+        // Несколько упорядоченных и обратно упорядоченных серий
+        std::vector<int> runs_keys(n);
+        for(auto i = 0; i < n; ++ i)
+        {
+            runs_keys[i] = (i / 300 % 2 == 0) ? i % 300 / 10 : (300 - i % 300) / 10;
+        }
+
+        for(auto const & keys : {random_keys, sorted_keys, reversed_keys,
+                                 runs_keys, std::vector<int>(n, 42)})
+        {
+            std::vector<Value> x_std;
+            for(auto i = 0; i < n; ++ i)
+            {
+                x_std.emplace_back(keys[i], i);
+            }
+            auto x_ural = x_std;
+
+            std::stable_sort(x_std.begin(), x_std.end(), cmp);
+            auto const result = ural::stable_sort(x_ural, cmp);
+
+            BOOST_CHECK(x_std == x_ural);
+            BOOST_CHECK(!result);
+            BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(stable_sort_test_strings_reversed)
+{
+    std::uniform_int_distribution<int> d('a', 'c');
+
+    std::vector<std::string> x_std(5000);
+    for(auto & s : x_std)
+    {
+        std::generate_n(std::back_inserter(s), 3,
+                        [&]{ return char(d(ural_test::random_engine())); });
+    }
+    auto x_ural = x_std;
+
+    auto const cmp = [](std::string const & x, std::string const & y)
+                     { return x.front() < y.front(); };
+
+    std::stable_sort(x_std.rbegin(), x_std.rend(), cmp);
+    ural::stable_sort(x_ural | ural_ex::reversed, cmp);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(sort_parallel_test)
+{
+    std::uniform_int_distribution<int> d(0, 1000);
+
+    for(auto n : {0, 1, 1000, 100000, 300000})
+    {
+        std::vector<int> x_std;
+        std::generate_n(std::back_inserter(x_std), n,
+                        [&]{ return d(ural_test::random_engine()); });
+
+        auto x_ural = x_std;
+        auto x_ural_4 = x_std;
+
+        std::sort(x_std.begin(), x_std.end());
+        auto const result = ural::sort(ural::par, x_ural);
+        ural::sort(ural::par(4), x_ural_4);
+
+        BOOST_CHECK(x_std == x_ural);
+        BOOST_CHECK(x_std == x_ural_4);
+        BOOST_CHECK(!result);
+        BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(stable_sort_parallel_test)
+{
+    // Ключ --- первый элемент, второй хранит исходную позицию
+    using Value = std::pair<int, int>;
+    auto const cmp = [](Value const & x, Value const & y)
+                     { return x.first < y.first; };
+
+    std::uniform_int_distribution<int> d(0, 100);
+
+    for(auto n : {0, 1, 1000, 100000, 300000})
+    {
+        std::vector<Value> x_std;
+        for(auto i = 0; i < n; ++ i)
+        {
+            x_std.emplace_back(d(ural_test::random_engine()), i);
+        }
+
+        auto x_ural = x_std;
+        auto x_ural_3 = x_std;
+
+        std::stable_sort(x_std.begin(), x_std.end(), cmp);
+        auto const result = ural::stable_sort(ural::par, x_ural, cmp);
+        ural::stable_sort(ural::par(3), x_ural_3, cmp);
+
+        BOOST_CHECK(x_std == x_ural);
+        BOOST_CHECK(x_std == x_ural_3);
+        BOOST_CHECK(!result);
+        BOOST_CHECK(::ural::cursor(x_ural) == result.traversed_front());
+    }
+}
+
+namespace
+{
+    // Значение, считающее количество существующих объектов
+    class Live_counted
+    {
+    public:
+        static std::atomic<long> & live()
+        {
+            static std::atomic<long> inst{0};
+            return inst;
+        }
+
+        explicit Live_counted(int x)
+         : value(x)
+        {
+            ++ live();
+        }
+
+        Live_counted(Live_counted const & x)
+         : value(x.value)
+        {
+            ++ live();
+        }
+
+        Live_counted & operator=(Live_counted const &) = default;
+
+        ~Live_counted()
+        {
+            -- live();
+        }
+
+        int value;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(sort_parallel_test_throwing_compare)
+{
+    auto const n = 1 << 16;
+
+    std::uniform_int_distribution<int> d(0, 1000);
+
+    for(auto stable : {false, true})
+    {
+        auto const live_old = Live_counted::live().load();
+        {
+            std::vector<Live_counted> xs;
+            for(auto i = 0; i < n; ++ i)
+            {
+                xs.emplace_back(d(ural_test::random_engine()));
+            }
+
+            std::atomic<int> calls{0};
+            auto const cmp = [&](Live_counted const & x, Live_counted const & y)
+            {
+                if(++ calls == n)
+                {
+                    throw std::runtime_error("compare");
+                }
+                return x.value < y.value;
+            };
+
+            if(stable)
+            {
+                BOOST_CHECK_THROW(ural::stable_sort(ural::par(4), xs, cmp),
+                                  std::runtime_error);
+            }
+            else
+            {
+                BOOST_CHECK_THROW(ural::sort(ural::par(4), xs, cmp),
+                                  std::runtime_error);
+            }
+
+            BOOST_CHECK_EQUAL(Live_counted::live().load(), live_old + n);
+        }
+        BOOST_CHECK_EQUAL(Live_counted::live().load(), live_old);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(radix_sort_test_throwing_key)
+{
+    auto const n = 1000;
+
+    std::uniform_int_distribution<int> d(0, 1 << 20);
+
+    auto const live_old = Live_counted::live().load();
+    {
+        std::vector<Live_counted> xs;
+        for(auto i = 0; i < n; ++ i)
+        {
+            xs.emplace_back(d(ural_test::random_engine()));
+        }
+
+        // Исключение возникает во время первого переноса в буфер
+        auto calls = 0;
+        auto const key = [&](Live_counted const & x)
+        {
+            if(++ calls == n + int(sizeof(int)) + n / 2)
+            {
+                throw std::runtime_error("key");
+            }
+            return x.value;
+        };
+
+        BOOST_CHECK_THROW(ural::radix_sort(xs, key), std::runtime_error);
+
+        BOOST_CHECK_EQUAL(Live_counted::live().load(), live_old + n);
+    }
+    BOOST_CHECK_EQUAL(Live_counted::live().load(), live_old);
+}
+
+BOOST_AUTO_TEST_CASE(partial_sort_test)
+{
+    std::array<int, 10> const xs {5, 7, 4, 2, 8, 6, 1, 9, 0, 3};
+    auto ys = xs;
+
+    auto const part = 3;
+
+    auto const result = ural::partial_sort(ys, part);
+
+    BOOST_CHECK(std::is_sorted(ys.begin(), ys.begin() + part));
+    BOOST_CHECK(ural::is_permutation(xs, ys));
+    BOOST_CHECK(std::all_of(ys.begin() + part, ys.end(),
+                            [=](int x) {return x >= ys[2];}));
+
+    BOOST_CHECK(result.begin() == ys.end());
+    BOOST_CHECK(result.end()   == ys.end());
+    BOOST_CHECK(result.traversed_front().begin() == ys.begin());
+    BOOST_CHECK(result.traversed_front().end()   == ys.end());
+}
+
+BOOST_AUTO_TEST_CASE(partial_sort_parallel_test)
+{
+    std::uniform_int_distribution<int> d(0, 1000);
+
+    std::vector<int> xs;
+    std::generate_n(std::back_inserter(xs), 200000,
+                    [&]{ return d(ural_test::random_engine()); });
+
+    auto sorted = xs;
+    std::sort(sorted.begin(), sorted.end());
+
+    for(auto part : {0, 10, 100000, 200000})
+    {
+        auto ys = xs;
+
+        auto const result = ural::partial_sort(ural::par(4), ys, part);
+
+        BOOST_CHECK(std::equal(ys.begin(), ys.begin() + part, sorted.begin()));
+        BOOST_CHECK(ural::is_permutation(xs, ys));
+
+        BOOST_CHECK(!result);
+        BOOST_CHECK(::ural::cursor(ys) == result.traversed_front());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(partial_sort_reversed_test)
+{
+    std::array<int, 10> const ys {5, 7, 4, 2, 8, 6, 1, 9, 0, 3};
+
+    auto xs = ys;
+
+    ural::partial_sort(xs | ural_ex::reversed, xs.size());
+
+    BOOST_CHECK(std::is_sorted(xs.rbegin(), xs.rend()));
+    BOOST_CHECK(ural::is_permutation(xs, ys));
+}
+
+BOOST_AUTO_TEST_CASE(partial_sort_copy_test)
+{
+    std::list<int> const src{4, 2, 5, 1, 3};
+
+    std::vector<int> r1_std{10, 11, 12};
+    std::vector<int> r1_ural{10, 11, 12};
+
+    auto pos_std = std::partial_sort_copy(src.begin(), src.end(),
+                                          r1_std.begin(), r1_std.end());
+    auto pos_ural = ural::partial_sort_copy(src, r1_ural);
+
+    BOOST_CHECK(pos_ural.original() == ural::cursor(r1_ural));
+    BOOST_CHECK_EQUAL(r1_std.end() - pos_std, pos_ural.size());
+    BOOST_CHECK_EQUAL(pos_std - r1_std.begin(), pos_ural.traversed_front().size());
+
+    URAL_CHECK_EQUAL_RANGES(r1_std, r1_ural);
+}
+
+BOOST_AUTO_TEST_CASE(partial_sort_copy_test_custom_predicate_to_greater)
+{
+    std::list<int> const src{4, 2, 5, 1, 3};
+
+    std::vector<int> r2_std{10, 11, 12, 13, 14, 15, 16};
+    std::vector<int> r2_ural{10, 11, 12, 13, 14, 15, 16};
+
+    auto pos_std = std::partial_sort_copy(src.begin(), src.end(),
+                                     r2_std.begin(), r2_std.end(),
+                                     std::greater<int>());
+    auto pos_ural = ural::partial_sort_copy(src, r2_ural, ural::greater<>());
+
+    BOOST_CHECK(pos_ural.original() == ural::cursor(r2_ural));
+    BOOST_CHECK_EQUAL(r2_std.end() - pos_std, pos_ural.size());
+    BOOST_CHECK_EQUAL(pos_std - r2_std.begin(), pos_ural.traversed_front().size());
+
+    URAL_CHECK_EQUAL_RANGES(r2_std, r2_ural);
+}
+
+BOOST_AUTO_TEST_CASE(is_sorted_test)
+{
+    std::vector<int> digits {3, 1, 4, 1, 5};
+
+    BOOST_CHECK_EQUAL(false, ural::is_sorted(digits));
+    BOOST_CHECK_EQUAL(std::is_sorted(digits.begin(), digits.end()),
+                      ural::is_sorted(digits));
+
+    std::sort(digits.begin(), digits.end());
+
+    BOOST_CHECK_EQUAL(true, std::is_sorted(digits.begin(), digits.end()));
+    BOOST_CHECK_EQUAL(true, ural::is_sorted(digits));
+}
+
+BOOST_AUTO_TEST_CASE(is_sorted_until_test)
+{
+    std::vector<int> nums = {1, 3, 4, 5, 9};
+
+    do
+    {
+        auto result_std = std::is_sorted_until(nums.begin(), nums.end());
+        auto result_ural = ural::is_sorted_until(nums);
+
+        BOOST_CHECK(result_ural.original() == ural::cursor(nums));
+        BOOST_CHECK(result_ural.begin() == result_std);
+        BOOST_CHECK(result_ural.end() == nums.end());
+    }
+    while(std::next_permutation(nums.begin(), nums.end()));
+}
+
+namespace
+{
+    typedef boost::mpl::list<char, signed char, unsigned char, short,
+                             unsigned short, int, unsigned int,
+                             long long, unsigned long long, float, double>
+        Ordered_arithmetic_types;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(is_sorted_until_test_contiguous,
+                              Value, Ordered_arithmetic_types)
+{
+    for(auto n : {0, 1, 2, 16, 17, 33, 70})
+    for(auto pos : {1, 2, 15, 16, 31, 32, 33, 69})
+    {
+        std::vector<Value> v;
+
+        for(auto i = 0; i < n; ++ i)
+        {
+            v.push_back(static_cast<Value>(i / 3));
+        }
+
+        BOOST_CHECK(ural::is_sorted(v));
+        BOOST_CHECK(ural::is_sorted_until(v).begin() == v.end());
+
+        if(pos < n)
+        {
+            v[pos] = static_cast<Value>(v[pos - 1] - 1);
+        }
+
+        auto const r_std = std::is_sorted_until(v.begin(), v.end());
+        auto const r_ural = ural::is_sorted_until(v);
+
+        BOOST_CHECK(r_ural.begin() == r_std);
+        BOOST_CHECK(r_ural.end() == v.end());
+        BOOST_CHECK_EQUAL(ural::is_sorted(v), std::is_sorted(v.begin(), v.end()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(is_sorted_until_test_nan)
+{
+    auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+    std::vector<double> v(40);
+
+    for(auto i = 0; i < 40; ++ i)
+    {
+        v[i] = i;
+    }
+
+    v[5] = nan;
+    v[25] = -1.0;
+
+    auto const r_std = std::is_sorted_until(v.begin(), v.end());
+
+    BOOST_CHECK(ural::is_sorted_until(v).begin() == r_std);
+}
+
+BOOST_AUTO_TEST_CASE(nth_element_test)
+{
+    std::vector<int> x_std{5, 6, 4, 3, 2, 6, 7, 9, 3};
+    auto x_ural = x_std;
+
+    auto const pos_1 = x_std.size() / 2;
+
+    std::nth_element(x_std.begin(), x_std.begin() + pos_1, x_std.end());
+
+    auto s_std = ural::cursor(x_std) + pos_1;
+    auto s_ural = ural::cursor(x_ural) + pos_1;
+
+    auto result = ural::nth_element(s_ural);
+
+    BOOST_CHECK(ural::is_permutation(x_std, x_ural));
+    BOOST_CHECK_EQUAL(x_std[pos_1], x_ural[pos_1]);
+
+    BOOST_CHECK(ural::is_permutation(s_std, s_ural));
+    BOOST_CHECK(ural::is_permutation(s_std.traversed_front(),
+                                     s_ural.traversed_front()));
+
+    BOOST_CHECK(result.begin() == x_ural.end());
+    BOOST_CHECK(result.end()   == x_ural.end());
+    BOOST_CHECK(result.traversed_front().begin() == x_ural.begin());
+    BOOST_CHECK(result.traversed_front().end()   == x_ural.end());
+}
+
+BOOST_AUTO_TEST_CASE(nth_element_test_index)
+{
+    std::uniform_int_distribution<int> d(0, 100);
+
+    for(auto n : {1, 2, 17, 100, 1000, 10000})
+    {
+        std::vector<int> random_values;
+        std::generate_n(std::back_inserter(random_values), n,
+                        [&]{ return d(ural_test::random_engine()); });
+
+        auto sorted_values = random_values;
+        std::sort(sorted_values.begin(), sorted_values.end());
+
+        auto reversed_values = sorted_values;
+        std::reverse(reversed_values.begin(), reversed_values.end());
+
+        // Вырожденный случай для выбора по медиане трёх
+        std::vector<int> organ_pipe(n);
+        for(auto i = 0; i < n; ++ i)
+        {
+            organ_pipe[i] = std::min(i, n - 1 - i);
+        }
+
+        for(auto const & values : {random_values, sorted_values,
+                                   reversed_values, organ_pipe,
+                                   std::vector<int>(n, 42)})
+        {
+            auto sorted = values;
+            std::sort(sorted.begin(), sorted.end());
+
+            for(auto nth : {0, n / 4, n / 2, n - 1})
+            {
+                auto x = values;
+                auto const result = ural::nth_element(x, nth);
+
+                BOOST_CHECK(ural::is_permutation(x, values));
+                BOOST_CHECK_EQUAL(x[nth], sorted[nth]);
+                BOOST_CHECK(std::all_of(x.begin(), x.begin() + nth,
+                                        [&](int a) { return !(x[nth] < a); }));
+                BOOST_CHECK(std::all_of(x.begin() + nth, x.end(),
+                                        [&](int a) { return !(a < x[nth]); }));
+
+                BOOST_CHECK(!result);
+                BOOST_CHECK(::ural::cursor(x) == result.traversed_front());
+            }
+        }
+    }
+}
+
+// 25.4.3 Бинарный поиск
+BOOST_AUTO_TEST_CASE(lower_bound_test)
+{
+    std::vector<int> const data = { 1, 1, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 6 };
+    auto const value = 4;
+
+    auto r_std = std::lower_bound(data.begin(), data.end(), value);
+    auto r_ural = ural::lower_bound(data, value);
+
+    BOOST_CHECK(!!r_ural);
+    BOOST_CHECK_EQUAL(*r_std, *r_ural);
+
+    BOOST_CHECK(data.begin() == r_ural.traversed_begin());
+    BOOST_CHECK(r_std == r_ural.begin());
+    BOOST_CHECK(data.end() == r_ural.end());
+    BOOST_CHECK(data.end() == r_ural.traversed_end());
+}
+
+BOOST_AUTO_TEST_CASE(upper_bound_test)
+{
+    std::vector<int> const data = { 1, 1, 2, 3, 3, 3, 3, 4, 4, 4, 5, 5, 6 };
+    auto const value = 4;
+
+    auto r_std = std::upper_bound(data.begin(), data.end(), value);
+    auto r_ural = ural::upper_bound(data, value);
+
+    BOOST_CHECK(!!r_ural);
+    BOOST_CHECK_EQUAL(*r_std, *r_ural);
+
+    BOOST_CHECK(data.begin() == r_ural.traversed_begin());
+    BOOST_CHECK(r_std == r_ural.begin());
+    BOOST_CHECK(data.end() == r_ural.end());
+    BOOST_CHECK(data.end() == r_ural.traversed_end());
+}
+
+BOOST_AUTO_TEST_CASE(lower_upper_bound_test_all_positions)
+{
+    for(auto n : {0, 1, 2, 3, 7, 8, 33, 100})
+    {
+        std::vector<int> data;
+        for(auto i = 0; i < n; ++ i)
+        {
+            data.push_back(2 * (i / 3));
+        }
+
+        std::vector<std::string> strings;
+        for(auto const & x : data)
+        {
+            strings.push_back(std::to_string(1001 + x));
+        }
+
+        for(auto value = -1; value <= 2 * (n / 3) + 1; ++ value)
+        {
+            auto const lb = std::lower_bound(data.begin(), data.end(), value);
+            auto const ub = std::upper_bound(data.begin(), data.end(), value);
+
+            BOOST_CHECK(ural::lower_bound(data, value).begin() == lb);
+            BOOST_CHECK(ural::upper_bound(data, value).begin() == ub);
+            BOOST_CHECK_EQUAL(ural::binary_search(data, value),
+                              std::binary_search(data.begin(), data.end(), value));
+
+            auto const r = ural::equal_range(data, value);
+            BOOST_CHECK(r.begin() == lb);
+            BOOST_CHECK(r.end() == ub);
+
+            auto const s = std::to_string(1001 + value);
+
+            BOOST_CHECK_EQUAL(ural::lower_bound(strings, s).traversed_front().size(),
+                              lb - data.begin());
+            BOOST_CHECK_EQUAL(ural::upper_bound(strings, s).traversed_front().size(),
+                              ub - data.begin());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lower_bound_test_greater)
+{
+    std::vector<double> const data = { 6, 5, 5, 4, 4, 4, 3, 1.5, 1, 1 };
+
+    for(auto const & value : {7.0, 5.0, 4.5, 1.0, 0.0})
+    {
+        auto const r_std = std::lower_bound(data.begin(), data.end(), value,
+                                            std::greater<>{});
+        auto const r_ural = ural::lower_bound(data, value, ural::greater<>{});
+
+        BOOST_CHECK(r_std == r_ural.begin());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lower_bound_many_test)
+{
+    std::vector<int> data;
+    for(auto i = 0; i < 1000; ++ i)
+    {
+        data.push_back(i / 2 * 3);
+    }
+
+    std::vector<int> values;
+    for(auto i = -5; i < 1600; i += 7)
+    {
+        values.push_back(i);
+    }
+
+    std::vector<std::ptrdiff_t> expected;
+    for(auto const & v : values)
+    {
+        expected.push_back(std::lower_bound(data.begin(), data.end(), v) - data.begin());
+    }
+
+    std::vector<std::ptrdiff_t> result(values.size(), -1);
+    auto r = ural::lower_bound_many(data, values, result);
+
+    BOOST_CHECK(!std::get<0>(r));
+    URAL_CHECK_EQUAL_RANGES(result, expected);
+}
+
+BOOST_AUTO_TEST_CASE(lower_bound_many_test_short_output)
+{
+    std::vector<int> const data = { 1, 3, 3, 5, 7 };
+    std::vector<int> const values = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+    std::vector<std::ptrdiff_t> const expected = { 0, 0, 1, 1, 3 };
+
+    std::vector<std::ptrdiff_t> result(expected.size(), -1);
+    auto r = ural::lower_bound_many(data, values, result);
+
+    URAL_CHECK_EQUAL_RANGES(result, expected);
+    BOOST_CHECK(!std::get<1>(r));
+    BOOST_CHECK_EQUAL(ural::size(std::get<0>(r)), values.size() - expected.size());
+    BOOST_CHECK_EQUAL(std::get<0>(r).front(), values[expected.size()]);
+
+    std::vector<int> const empty;
+    std::vector<std::ptrdiff_t> zeros(values.size(), -1);
+    ural::lower_bound_many(empty, values, zeros);
+
+    BOOST_CHECK(std::all_of(zeros.begin(), zeros.end(), [](auto x) { return x == 0; }));
+}
+
+BOOST_AUTO_TEST_CASE(equal_range_test)
+{
+    auto const src = []()
+    {
+        std::vector<int> v = {10,20,30,30,20,10,10,20};
+        std::sort (v.begin(), v.end());
+        return v;
+    }();
+
+    auto const value = 20;
+
+    auto r_std = std::equal_range (src.begin(), src.end(), value);
+    auto r_ural = ural::equal_range(src, value);
+
+    BOOST_CHECK(r_std.first == r_ural.begin());
+    BOOST_CHECK_EQUAL(r_std.second - r_std.first,
+                      r_ural.end() - r_ural.begin());
+    BOOST_CHECK(src.begin() == r_ural.traversed_begin());
+    BOOST_CHECK(src.end() == r_ural.traversed_end());
+}
+
+BOOST_AUTO_TEST_CASE(equal_range_different_traversed_front)
+{
+    auto const s1 = ural::numbers(1, 9);
+    auto const s2 = ural::numbers(0, 9);
+
+    auto const s = ural_ex::make_cartesian_product_cursor(s1, s2);
+
+    static_assert(!std::is_same<decltype(s), decltype(s.traversed_front())>::value, "");
+
+    assert(ural::is_sorted(s));
+
+    auto const needle = ural::value_type_t<decltype(s)>{4, 2};
+
+    auto pos = ural::equal_range(s, needle);
+
+    assert(!!pos);
+    BOOST_CHECK(*pos == needle);
+    BOOST_CHECK_EQUAL(ural::size(pos), 1);
+
+    BOOST_CHECK(pos.base().original() == s);
+
+    assert(!!pos.traversed_front());
+    BOOST_CHECK(pos.traversed_front().front() == s.front());
+}
+
+BOOST_AUTO_TEST_CASE(binary_search_test)
+{
+    std::vector<int> const haystack {1, 3, 4, 5, 9};
+    std::vector<int> const needles {1, 2, 3, 10};
+
+    for (auto needle : needles)
+    {
+        auto r_std = std::binary_search(haystack.begin(), haystack.end(), needle);
+        auto r_ural = ural::binary_search(haystack, needle);
+
         BOOST_CHECK_EQUAL(r_std, r_ural);
-    }
-}
-
-BOOST_AUTO_TEST_CASE(includes_test_custom_compare)
-{
-    std::vector<std::string> vs{"abcfhx", "abc", "ac", "g", "acg", {}};
-    std::string v_0 {"ABC"};
-
-    auto cmp_nocase = [](char a, char b) {
-    return std::tolower(a) < std::tolower(b);
-    };
-
-    for(auto const & s : vs)
-    {
-        bool const r_std = std::includes(s.begin(), s.end(),
-                                         v_0.begin(), v_0.end(), cmp_nocase);        std::istringstream s_stream(s);
-        std::istringstream v_0_stream(v_0);
-
-        bool const r_ural
-            = ural::includes(ural::experimental::make_istream_cursor<char>(s_stream),
-                             ural::experimental::make_istream_cursor<char>(v_0_stream),
-                             cmp_nocase);
+    }
+}
+
+// 25.4.4 Слияние
+BOOST_AUTO_TEST_CASE(merge_test)
+{
+    // Исходные данные
+    std::vector<int> const v1{1,2,3,4,5,6,7,8};
+    std::vector<int> const v2{        5,  7,  9,10};
+
+    // std
+    std::vector<int> std_merge;
+    std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
+               std::back_inserter(std_merge));
+
+    // ural
+    std::vector<int> ural_merge;
+    ural::merge(v1, v2, ural_merge | ural::back_inserter);
+
+    // Проверка
+    URAL_CHECK_EQUAL_RANGES(std_merge, ural_merge);
+}
+
+BOOST_AUTO_TEST_CASE(merge_test_lesser_in_1)
+{
+    // Исходные данные
+    std::vector<int> const v1{1,2,3,4,5,6,7,8};
+    std::vector<int> const v2{        5,  7,  9,10};
+
+    BOOST_CHECK_LE(v1.back(), v2.back());
+
+    // std
+    std::vector<int> std_merge;
+    std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
+               std::back_inserter(std_merge));
+
+    // ural
+    std::vector<int> ural_merge(v1.size() + v2.size() + 3, - 1);
+    auto const ural_merge_old = ural_merge;
+
+    auto const result = ural::merge(v1, v2, ural_merge);
+
+    BOOST_CHECK(!result[ural::_1]);
+    BOOST_CHECK(!result[ural::_2]);
+    BOOST_CHECK(!!result[ural::_3]);
+
+    BOOST_CHECK(result[ural::_1].original() == ural::cursor(v1));
+    BOOST_CHECK(result[ural::_2].original() == ural::cursor(v2));
+    BOOST_CHECK(result[ural::_3].original() == ural::cursor(ural_merge));
+
+    BOOST_CHECK(result[ural::_3].begin() == ural_merge.begin() + std_merge.size());
+
+    // Проверка
+    BOOST_CHECK_EQUAL_COLLECTIONS(std_merge.begin(), std_merge.end(),
+                                  ural_merge.begin(), result[ural::_3].begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(result[ural::_3].begin(), result[ural::_3].end(),
+                                  ural_merge_old.begin() + std_merge.size(),
+                                  ural_merge_old.end());
+}
+
+BOOST_AUTO_TEST_CASE(merge_test_lesser_in_2)
+{
+    // Исходные данные
+    std::vector<int> const v1{1,2,3,4,5,6,7,8,     11};
+    std::vector<int> const v2{        5,  7,  9,10};
+
+    BOOST_CHECK_GE(v1.back(), v2.back());
+
+    // std
+    std::vector<int> std_merge;
+    std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
+               std::back_inserter(std_merge));
+
+    // ural
+    std::vector<int> ural_merge(v1.size() + v2.size() + 3, - 1);
+    auto const ural_merge_old = ural_merge;
+
+    auto const result = ural::merge(v1, v2, ural_merge);
+
+    BOOST_CHECK(!result[ural::_1]);
+    BOOST_CHECK(!result[ural::_2]);
+    BOOST_CHECK(!!result[ural::_3]);
+
+    BOOST_CHECK(result[ural::_1].original() == ural::cursor(v1));
+    BOOST_CHECK(result[ural::_2].original() == ural::cursor(v2));
+    BOOST_CHECK(result[ural::_3].original() == ural::cursor(ural_merge));
+
+    BOOST_CHECK(result[ural::_3].begin() == ural_merge.begin() + std_merge.size());
+
+    // Проверка
+    BOOST_CHECK_EQUAL_COLLECTIONS(std_merge.begin(), std_merge.end(),
+                                  ural_merge.begin(), result[ural::_3].begin());
+    BOOST_CHECK_EQUAL_COLLECTIONS(result[ural::_3].begin(), result[ural::_3].end(),
+                                  ural_merge_old.begin() + std_merge.size(),
+                                  ural_merge_old.end());
+}
+
+BOOST_AUTO_TEST_CASE(merge_test_exhaust_out)
+{
+    // Исходные данные
+    std::vector<int> const v1{1,2,3,4,5,6,7,8,     11};
+    std::vector<int> const v2{        5,  7,  9,10};
+
+    // ural
+    std::vector<int> ural_merge((v1.size() + v2.size()) / 2, - 1);
+
+    auto const result = ural::merge(v1, v2, ural_merge);
+
+    BOOST_CHECK(!!result[ural::_1]);
+    BOOST_CHECK(!!result[ural::_2]);
+    BOOST_CHECK(!result[ural::_3]);
+
+    BOOST_CHECK(result[ural::_1].original() == ural::cursor(v1));
+    BOOST_CHECK(result[ural::_2].original() == ural::cursor(v2));
+    BOOST_CHECK(result[ural::_3].original() == ural::cursor(ural_merge));
+
+    BOOST_CHECK(!result[ural::_1].traversed_back());
+    BOOST_CHECK(!result[ural::_2].traversed_back());
+
+    // std
+    std::vector<int> std_merge;
+    std::merge(result[ural::_1].traversed_begin(),
+               result[ural::_1].begin(),
+               result[ural::_2].traversed_begin(),
+               result[ural::_2].begin(),
+               std::back_inserter(std_merge));
+
+    // Проверка
+    URAL_CHECK_EQUAL_RANGES(ural_merge, std_merge);
+}
+
+BOOST_AUTO_TEST_CASE(merge_test_minimalistic)
+{
+    // Исходные данные
+    std::istringstream is1("1 2 3 4 5 6 7 8");
+    std::istringstream is2("        5   7 9 10");
+
+    std::istringstream is1_ural("1 2 3 4 5 6 7 8");
+    std::istringstream is2_ural("        5   7 9 10");
+
+    // std
+    std::vector<int> std_merge;
+    std::merge(std::istream_iterator<int>(is1), std::istream_iterator<int>(),
+               std::istream_iterator<int>(is2), std::istream_iterator<int>(),
+               std::back_inserter(std_merge));
+
+    // ural
+    std::vector<int> ural_merge;
+    ural::merge(ural::experimental::make_istream_cursor<int>(is1_ural),
+                ural::experimental::make_istream_cursor<int>(is2_ural),
+                ural_merge | ural::back_inserter);
+
+    // Проверка
+    URAL_CHECK_EQUAL_RANGES(std_merge, ural_merge);
+}
+
+BOOST_AUTO_TEST_CASE(k_merge_test)
+{
+    std::vector<std::list<int>> runs(64);
+    for(auto i = 0; i < 1000; ++ i)
+    {
+        runs[(i * 37) % runs.size()].push_back(i);
+    }
+
+    std::vector<int> result(1000 + 5, -1);
+    auto r = ural::k_merge(runs, result);
+
+    BOOST_CHECK(std::is_sorted(result.begin(), result.begin() + 1000));
+    BOOST_CHECK_EQUAL(result.front(), 0);
+    BOOST_CHECK_EQUAL(result[999], 999);
+    BOOST_CHECK_EQUAL(ural::size(r[ural::_2]), 5);
+
+    for(auto const & in : r[ural::_1])
+    {
+        BOOST_CHECK(!in);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(k_merge_test_short_output)
+{
+    std::vector<std::vector<int>> const runs = {{1, 4, 7}, {2, 5, 8}, {3, 6, 9}};
+    std::vector<int> const expected = {1, 2, 3, 4};
+
+    std::vector<int> result(expected.size());
+    auto r = ural::k_merge(runs, result);
+
+    URAL_CHECK_EQUAL_RANGES(result, expected);
+    BOOST_CHECK(!r[ural::_2]);
+
+    auto const & rest = r[ural::_1];
+
+    BOOST_CHECK_EQUAL(rest.size(), runs.size());
+    BOOST_CHECK_EQUAL(rest[0].front(), 7);
+    BOOST_CHECK_EQUAL(rest[1].front(), 5);
+    BOOST_CHECK_EQUAL(rest[2].front(), 6);
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_empty)
+{
+    std::vector<int> x_std{};
+    auto x_ural = x_std;
+
+    auto pos = x_std.size() / 2;
+
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos, x_std.end());
+
+    auto s = ::ural::cursor(x_ural);
+    s += pos;
+    auto result = ural::inplace_merge(s);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+
+    BOOST_CHECK(result.begin() == x_ural.end());
+    BOOST_CHECK(result.end()   == x_ural.end());
+    BOOST_CHECK(result.traversed_front().begin() == x_ural.begin());
+    BOOST_CHECK(result.traversed_front().end()   == x_ural.end());
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_1)
+{
+    std::vector<int> x_std{1};
+    auto x_ural = x_std;
+
+    auto pos = x_std.size() / 2;
+
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
+                       x_std.end());
+    auto s = ::ural::cursor(x_ural);
+    s += pos;
+    ural::inplace_merge(s);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_1_2)
+{
+    std::vector<int> x_std{1, 2};
+    auto x_ural = x_std;
+
+    auto pos = x_std.size() / 2;
+
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
+                       x_std.end());
+    auto s = ::ural::cursor(x_ural);
+    s += pos;
+    ural::inplace_merge(s);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_2_1)
+{
+    std::vector<int> x_std{2, 1};
+    auto x_ural = x_std;
+
+    auto pos = x_std.size() / 2;
+
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
+                       x_std.end());
+    auto s = ::ural::cursor(x_ural);
+    s += pos;
+    ural::inplace_merge(s);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_2_1_3)
+{
+    std::vector<int> x_std{3, 1, 2};
+    auto x_ural = x_std;
+
+    auto pos = x_std.size() / 2;
+
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
+                       x_std.end());
+    auto s = ::ural::cursor(x_ural);
+    s += pos;
+    ural::inplace_merge(s);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_4)
+{
+    std::vector<int> x_std{1, 2, 0, 4};
+    auto x_ural = x_std;
+
+    auto pos = x_std.size() / 2;
+
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
+                       x_std.end());
+    auto s = ::ural::cursor(x_ural);
+    s += pos;
+    ural::inplace_merge(s);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_10)
+{
+    std::vector<int> x_std{1, 2, 3, 5, 8, 0, 4, 6, 7, 9};
+    auto x_ural = x_std;
+
+    auto pos = x_std.size() / 2;
+
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos,
+                       x_std.end());
+    auto s = ::ural::cursor(x_ural);
+    s += pos;
+    auto result = ural::inplace_merge(s);
+
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+    BOOST_CHECK(result.original() == ural::cursor(x_ural));
+    BOOST_CHECK(!result);
+    BOOST_CHECK(!result.traversed_back());
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_minimalistic)
+{
+    std::list<int> x_std{1, 2, 3, 5, 8, 0, 4, 6, 7, 9};
+    auto x_ural = x_std;
+
+    auto const pos =  x_std.size() / 2;
+
+    // std
+    std::inplace_merge(x_std.begin(), std::next(x_std.begin(), pos), x_std.end());
+
+    // ural
+    auto s = ::ural::cursor(x_ural);
+    ural::advance(s, pos);
+    auto result = ural::inplace_merge(s);
+
+    // Сравнение
+    URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+
+    BOOST_CHECK(result.original() == ural::cursor(x_ural));
+    BOOST_CHECK(!result);
+    BOOST_CHECK(!result.traversed_back());
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_different_sizes_is_stable)
+{
+    // Ключ --- первый элемент, второй хранит исходную позицию
+    using Value = std::pair<int, int>;
+    auto const cmp = [](Value const & x, Value const & y)
+                     { return x.first < y.first; };
+
+    std::uniform_int_distribution<int> d(0, 20);
+
+    for(auto sizes : {std::make_pair(1, 100), std::make_pair(100, 1),
+                      std::make_pair(37, 500), std::make_pair(500, 37),
+                      std::make_pair(300, 300)})
+    {
+        std::vector<Value> x_std;
+        for(auto i = 0; i < sizes.first + sizes.second; ++ i)
+        {
+            x_std.emplace_back(d(ural_test::random_engine()), i);
+        }
+
+        std::stable_sort(x_std.begin(), x_std.begin() + sizes.first, cmp);
+        std::stable_sort(x_std.begin() + sizes.first, x_std.end(), cmp);
+
+        auto x_ural = x_std;
+        std::list<Value> x_list(x_std.begin(), x_std.end());
+
+        std::inplace_merge(x_std.begin(), x_std.begin() + sizes.first,
+                           x_std.end(), cmp);
+
+        auto s = ::ural::cursor(x_ural);
+        s += sizes.first;
+        ural::inplace_merge(s, cmp);
+
+        auto s_list = ::ural::cursor(x_list);
+        ural::advance(s_list, sizes.first);
+        ural::inplace_merge(s_list, cmp);
+
+        BOOST_CHECK(x_std == x_ural);
+        BOOST_CHECK(std::equal(x_std.begin(), x_std.end(), x_list.begin()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_scratch_buffer)
+{
+    std::vector<int> const xs{1, 2, 3, 5, 8, 10, 11, 0, 4, 6, 7, 9};
+    auto const pos = 7;
+
+    auto x_std = xs;
+    std::inplace_merge(x_std.begin(), x_std.begin() + pos, x_std.end());
+
+    // Буфер достаточного размера, недостаточного размера и пустой
+    for(auto scratch_size : {5, 2, 0})
+    {
+        auto x_ural = xs;
+        std::vector<int> scratch(scratch_size);
+
+        auto s = ::ural::cursor(x_ural);
+        s += pos;
+        auto const result = ural::inplace_merge(s, ural::less<>{}, scratch);
+
+        URAL_CHECK_EQUAL_RANGES(x_std, x_ural);
+        BOOST_CHECK(result.original() == ural::cursor(x_ural));
+        BOOST_CHECK(!result);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_large_without_buffer)
+{
+    // Чередующиеся половины: поворачиваются длинные интервалы
+    auto const n = 100000;
+
+    std::vector<int> xs(n);
+    for(auto i = 0; i < n / 2; ++ i)
+    {
+        xs[i] = 2 * i;
+        xs[n / 2 + i] = 2 * i + 1;
+    }
+
+    std::vector<int> scratch;
+
+    auto s = ::ural::cursor(xs);
+    s += n / 2;
+    ural::inplace_merge(s, ural::less<>{}, scratch);
+
+    std::vector<int> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+
+    BOOST_CHECK(xs == expected);
+}
+
+BOOST_AUTO_TEST_CASE(inplace_merge_test_large_undersized_scratch)
+{
+    std::uniform_int_distribution<int> d(0, 1000);
+
+    for(auto n : {100000, 1000000})
+    for(auto interleaved : {true, false})
+    {
+        // Чётные числа, затем нечётные, или две случайные упорядоченные части
+        std::vector<int> xs(n);
+        for(auto i = 0; i < n; ++ i)
+        {
+            xs[i] = interleaved ? (i < n / 2 ? 2 * i : 2 * (i - n / 2) + 1)
+                                : d(ural_test::random_engine());
+        }
+
+        auto const pos = interleaved ? n / 2 : n / 3;
+
+        std::sort(xs.begin(), xs.begin() + pos);
+        std::sort(xs.begin() + pos, xs.end());
+
+        auto expected = xs;
+        std::sort(expected.begin(), expected.end());
+
+        for(auto scratch_size : {0, 16})
+        {
+            auto x_ural = xs;
+            std::vector<int> scratch(scratch_size);
+
+            auto s = ::ural::cursor(x_ural);
+            s += pos;
+            auto const result = ural::inplace_merge(s, ural::less<>{}, scratch);
+
+            BOOST_CHECK(x_ural == expected);
+            BOOST_CHECK(!result);
+        }
+    }
+}
+
+// 25.4.5 Операции со множествами на сортированных структурах
+BOOST_AUTO_TEST_CASE(includes_test)
+{
+    std::vector<std::string> vs{"abcfhx", "abc", "ac", "g", "acg", {}};
+
+    for(auto const & s1 : vs)
+    for(auto const & s2 : vs)
+    {
+        bool const r_std = std::includes(s1.begin(), s1.end(),
+                                         s2.begin(), s2.end());
+        bool const r_ural = ural::includes(s1, s2);
         BOOST_CHECK_EQUAL(r_std, r_ural);
-    }
-}
-
-BOOST_AUTO_TEST_CASE(includes_test_custom_compare_istream_auto_to_cursor)
-{
-    std::vector<std::string> vs{"abcfhx", "abc", "ac", "g", "acg", {}};
-    std::string v_0 {"ABC"};
-
-    auto cmp_nocase = [](char a, char b) {
-    return std::tolower(a) < std::tolower(b);
-    };
-
-    for(auto const & s : vs)
-    {
-        bool const r_std = std::includes(s.begin(), s.end(),
-                                         v_0.begin(), v_0.end(), cmp_nocase);        std::istringstream s_stream(s);
-        std::istringstream v_0_stream(v_0);
-
-        bool const r_ural = ural::includes(s_stream, v_0_stream, cmp_nocase);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(includes_test_skewed)
+{
+    std::vector<int> large;
+    for(auto i = 0; i < 10000; ++ i)
+    {
+        large.push_back(3 * i);
+    }
+
+    for(auto step : {1, 7, 300, 9999})
+    {
+        std::vector<int> small;
+        for(auto i = 0; i < 10000; i += step)
+        {
+            small.push_back(3 * i);
+        }
+
+        BOOST_CHECK(ural::includes(large, small));
+
+        small.push_back(small.back() + 1);
+        BOOST_CHECK(!ural::includes(large, small));
+
+        small.insert(small.begin(), -1);
+        BOOST_CHECK(!ural::includes(large, small));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(includes_test_custom_compare)
+{
+    std::vector<std::string> vs{"abcfhx", "abc", "ac", "g", "acg", {}};
+    std::string v_0 {"ABC"};
+
+    auto cmp_nocase = [](char a, char b) {
+    return std::tolower(a) < std::tolower(b);
+    };
+
+    for(auto const & s : vs)
+    {
+        bool const r_std = std::includes(s.begin(), s.end(),
+                                         v_0.begin(), v_0.end(), cmp_nocase);
+        std::istringstream s_stream(s);
+        std::istringstream v_0_stream(v_0);
+
+        bool const r_ural
+            = ural::includes(ural::experimental::make_istream_cursor<char>(s_stream),
+                             ural::experimental::make_istream_cursor<char>(v_0_stream),
+                             cmp_nocase);
         BOOST_CHECK_EQUAL(r_std, r_ural);
-    }
-}
-
-BOOST_AUTO_TEST_CASE(set_union_test)
-{
-    std::istringstream is1("1 2 3 4 5");
-    std::istringstream is2("    3 4 5 6 7");
-
-    std::vector<int> const z {1, 2, 3, 4, 5, 6, 7};
-
-    std::vector<int> r_ural;
-    ural::set_union(ural::experimental::make_istream_cursor<int>(is1),
-                    ural::experimental::make_istream_cursor<int>(is2),
-                    r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(set_union_test_shorter_in_1)
-{
-    std::vector<int> const is1{1, 2, 3, 4, 5,};
-    std::vector<int> const is2{      3, 4, 5, 6, 7};
-    std::vector<int> const z  {1, 2, 3, 4, 5, 6, 7};
-
-    BOOST_CHECK_LE(is1.back(), is2.back());
-
-    std::vector<int> r_ural;
-    auto result = ural::set_union(is1, is2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-
-    BOOST_CHECK(!result[ural::_1]);
-    BOOST_CHECK(!result[ural::_2]);
-    BOOST_CHECK(!!result[ural::_3]);
-}
-
-BOOST_AUTO_TEST_CASE(set_union_test_shorter_in_2)
-{
-    std::vector<int> const is1{1, 2, 3, 4, 5,    7};
-    std::vector<int> const is2{      3, 4, 5, 6};
-    std::vector<int> const z  {1, 2, 3, 4, 5, 6, 7};
-
-    BOOST_CHECK_LE(is2.back(), is1.back());
-
-    std::vector<int> r_ural;
-    auto result = ural::set_union(is1, is2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-
-    BOOST_CHECK(!result[ural::_1]);
-    BOOST_CHECK(!result[ural::_2]);
-    BOOST_CHECK(!!result[ural::_3]);
-}
-
-BOOST_AUTO_TEST_CASE(set_union_test_shorter_out)
-{
-    std::vector<int> const is1{1, 2, 3, 4, 5,};
-    std::vector<int> const is2{      3, 4, 5, 6, 7};
-    std::vector<int> const z  {1, 2, 3, 4, 5, 6, 7};
-
-    std::vector<int> r_ural(z.size() / 2, -1);
-    BOOST_CHECK_LE(r_ural.size(), z.size());
-    BOOST_CHECK(r_ural.empty() == false);
-
-    auto result = ural::set_union(is1, is2, r_ural);
-
-    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
-                                  z.begin(), z.begin() + r_ural.size());
-
-    BOOST_CHECK(!!result[ural::_1]);
-    BOOST_CHECK(!!result[ural::_2]);
-    BOOST_CHECK(!result[ural::_3]);
-
-    BOOST_CHECK(result[ural::_1].original() == ural::cursor(is1));
-    BOOST_CHECK(result[ural::_2].original() == ural::cursor(is2));
-    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
-
-    std::vector<int> r_std;
-    std::set_union(result[ural::_1].traversed_begin(),
-                   result[ural::_1].begin(),
-                   result[ural::_2].traversed_begin(),
-                   result[ural::_2].begin(),
-                   std::back_inserter(r_std));
-
-    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
-                                  r_std.begin(), r_std.end());
-}
-
-BOOST_AUTO_TEST_CASE(set_intersection_test)
-{
-    std::istringstream is1("1 2 3 4 5");
-    std::istringstream is2("  2   4 5 6 7");
-
-    std::vector<int> const z {2, 4, 5};
-
-    std::vector<int> r_ural;
-    ural::set_intersection(ural::experimental::make_istream_cursor<int>(is1),
-                           ural::experimental::make_istream_cursor<int>(is2),
-                           r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(set_intersection_test_shorter_in_1)
-{
-    std::vector<int> const is1{1, 2, 3, 4, 5};
-    std::vector<int> const is2{   2,    4, 5, 6, 7};
-    std::vector<int> const z  {   2,    4, 5};
-
-    BOOST_CHECK_LE(is1.size(), is2.size());
-    BOOST_CHECK_LE(is1.back(), is2.back());
-
-    std::vector<int> r_ural;
-    auto result = ural::set_intersection(is1, is2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-
-    BOOST_CHECK(!result[ural::_1]);
-
-    BOOST_CHECK(!!result[ural::_2]);
-    BOOST_CHECK_LE(z.back(), result[ural::_2].front());
-
-    BOOST_CHECK_EQUAL(is1.back(), result[ural::_2].front());
-
-    BOOST_CHECK(!!result[ural::_3]);
-}
-
-BOOST_AUTO_TEST_CASE(set_intersection_test_shorter_in_2)
-{
-    std::vector<int> const is1{   2, 3, 4, 5, 6, 7};
-    std::vector<int> const is2{1, 2,    4, 5};
-    std::vector<int> const z  {   2,    4, 5};
-
-    BOOST_CHECK_LE(is2.size(), is1.size());
-    BOOST_CHECK_LE(is2.back(), is1.back());
-
-    std::vector<int> r_ural;
-    auto result = ural::set_intersection(is1, is2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-
-    BOOST_CHECK(!!result[ural::_1]);
-    BOOST_CHECK(!result[ural::_2]);
-    BOOST_CHECK(!!result[ural::_3]);
-
-    BOOST_CHECK_LE(z.back(), result[ural::_1].front());
-
-    BOOST_CHECK_EQUAL(result[ural::_1].front(),
-                      ural::upper_bound(is1, is2.back()).front());
-}
-
-BOOST_AUTO_TEST_CASE(set_intersection_test_shorter_out)
-{
-    std::vector<int> const is1{   2, 3, 4, 5, 6, 7};
-    std::vector<int> const is2{1, 2,    4, 5};
-    std::vector<int> const z  {   2,    4, 5};
-
-    std::vector<int> r_ural(z.size() / 2, -1);
-    BOOST_CHECK_LE(r_ural.size(), z.size());
-    BOOST_CHECK(r_ural.empty() == false);
-
-    auto result = ural::set_intersection(is1, is2, r_ural);
-
-    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
-                                  z.begin(), z.begin() + r_ural.size());
-
-    BOOST_CHECK(!!result[ural::_1]);
-    BOOST_CHECK(!!result[ural::_2]);
-    BOOST_CHECK(!result[ural::_3]);
-
-    BOOST_CHECK(result[ural::_1].original() == ural::cursor(is1));
-    BOOST_CHECK(result[ural::_2].original() == ural::cursor(is2));
-    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
-
-    std::vector<int> r_std;
-    std::set_intersection(result[ural::_1].traversed_begin(),
-                          result[ural::_1].begin(),
-                          result[ural::_2].traversed_begin(),
-                          result[ural::_2].begin(),
-                          std::back_inserter(r_std));
-
-    URAL_CHECK_EQUAL_RANGES(r_ural, r_std);
-}
-
-BOOST_AUTO_TEST_CASE(set_difference_test)
-{
-    typedef ural_test::istringstream_helper<int> Source;
-    Source const is1            {1, 2, 3, 4, 5,      8};
-    Source const is2            {   2,    4, 5, 6, 7  };
-    std::vector<int> const z    {1,    3,            8};
-
-    std::vector<int> r_ural;
-    ural::set_difference(is1, is2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(set_difference_test_unexhausted_2)
-{
-    typedef ural_test::istringstream_helper<int> Source;
-    Source const is1            {1, 2, 3, 4, 5,      8};
-    Source const is2            {   2,    4, 5, 6, 7,  9};
-    std::vector<int> const z    {1,    3,            8};
-
-    std::vector<int> r_ural;
-    ural::set_difference(is1, is2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(set_difference_test_to_short)
-{
-    std::vector<int> is1     {1, 2, 3, 4, 5,       8};
-    std::vector<int> is2     {   2,    4, 5, 6, 7,   9};
-    std::vector<int> const z {1,    3,             8};
-
-    std::vector<int> r_ural(z.size() / 2, -1);
-
-    auto result = ural::set_difference(is1, is2, r_ural);
-
-    BOOST_CHECK(result[ural::_1].original() == ural::cursor(is1));
-    BOOST_CHECK(!!result[ural::_1]);
-    BOOST_CHECK_LE(r_ural.back(), result[ural::_1].front());
-
-    BOOST_CHECK(result[ural::_2].original() == ural::cursor(is2));
-    BOOST_CHECK(!!result[ural::_2]);
-    BOOST_CHECK_LE(r_ural.back(), result[ural::_2].front());
-
-    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
-    BOOST_CHECK(!result[ural::_3]);
-
-    assert(r_ural.size() < z.size());
-    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
-                                  z.begin(), z.begin() + r_ural.size());
-
-    std::vector<int> r_std;
-    std::set_difference(result[ural::_1].traversed_begin(),
-                        result[ural::_1].begin(),
-                        result[ural::_2].traversed_begin(),
-                        result[ural::_2].begin(),
-                        r_std | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(r_ural, r_std);
-}
-
-BOOST_AUTO_TEST_CASE(set_symmetric_difference_test)
-{
-    using Source = ural_test::istringstream_helper<int>;
-
-    Source const x1          {1, 2, 3, 4, 5, 6, 7, 8       };
-    Source const x2          {            5,    7,    9, 10};
-    std::vector<int> const z {1, 2, 3, 4,    6,    8, 9, 10};
-
-    // через back_inserter
-    std::vector<int> r_ural;
-    ural::set_symmetric_difference(x1, x2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(set_symmetric_difference_regression)
-{
-    std::vector<int> const x1{1, 2, 3, 4, 5,       8};
-    std::vector<int> const x2{   2,    4, 5, 6, 7   };
-    std::vector<int> const z {1,    3,       6, 7, 8};
-
-    BOOST_CHECK_GE(x1.back(), x2.back());
-
-    std::vector<int> r_ural;
-    ural::set_symmetric_difference(x1, x2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(set_symmetric_difference_from_istream)
-{
-    using Source = ural_test::istringstream_helper<int>;
-
-    Source const x1          {1, 2, 3, 4, 5, 6, 7, 8       };
-    Source const x2          {            5,    7,    9, 10};
-    std::vector<int> const z {1, 2, 3, 4,    6,    8, 9, 10};
-
-    std::vector<int> r_ural;
-    ural::set_symmetric_difference(x1, x2, r_ural | ural::back_inserter);
-
-    URAL_CHECK_EQUAL_RANGES(z, r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(set_symmetric_difference_to_short)
-{
-    std::vector<int> const x1{1, 2, 3, 4, 5,       8};
-    std::vector<int> const x2{   2,    4, 5, 6, 7   };
-    std::vector<int> const z {1,    3,       6, 7, 8};
-
-    std::vector<int> r_ural(z.size() / 2, - 1);
-
-    assert(!r_ural.empty());
-    assert(r_ural.size() < z.size());
-
-    auto result = ural::set_symmetric_difference(x1, x2, r_ural);
-
-    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
-                                  z.begin(), z.begin() + r_ural.size());
-
-    BOOST_CHECK(result[ural::_1].original() == ural::cursor(x1));
-    BOOST_CHECK(!!result[ural::_1]);
-    BOOST_CHECK_LE(r_ural.back(), result[ural::_1].front());
-
-    BOOST_CHECK(result[ural::_2].original() == ural::cursor(x2));
-    BOOST_CHECK(!!result[ural::_2]);
-    BOOST_CHECK_LE(r_ural.back(), result[ural::_2].front());
-
-    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
-    BOOST_CHECK(!result[ural::_3]);
-
-    std::vector<int> r_std;
-    std::set_symmetric_difference(result[ural::_1].traversed_begin(),
-                                  result[ural::_1].begin(),
-                                  result[ural::_2].traversed_begin(),
-                                  result[ural::_2].begin(),
-                                  std::back_inserter(r_std));
-    URAL_CHECK_EQUAL_RANGES(r_ural, r_std);
-}
-
-BOOST_AUTO_TEST_CASE(regression_33_set_operations_first_base)
-{
-    std::list<int> const x1{1, 2, 3, 4, 5,       8};
-    std::vector<int> const x2{   2,    4, 5, 6, 7   };
-
-    std::forward_list<int> out;
-
-    auto r_union = ural::set_union(x1, x2, out);
-    BOOST_CHECK(r_union[ural::_1].original() == ural::cursor(x1));
-    BOOST_CHECK(r_union[ural::_2].original() == ural::cursor(x2));
-
-    auto r_inter = ural::set_intersection(x1, x2, out);
-    BOOST_CHECK(r_inter[ural::_1].original() == ural::cursor(x1));
-    BOOST_CHECK(r_inter[ural::_2].original() == ural::cursor(x2));
-
-    auto r_diff  = ural::set_difference(x1, x2, out);
-    BOOST_CHECK(r_diff[ural::_1].original() == ural::cursor(x1));
-    BOOST_CHECK(r_diff[ural::_2].original() == ural::cursor(x2));
-
-    auto r_sdiff = ural::set_symmetric_difference(x1, x2, out);
-    BOOST_CHECK(r_sdiff[ural::_1].original() == ural::cursor(x1));
-    BOOST_CHECK(r_sdiff[ural::_2].original() == ural::cursor(x2));
-}
-
-// 25.4.6 Операции с бинарными кучами
-BOOST_AUTO_TEST_CASE(push_heap_test)
-{
-    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
-
-    for(auto i : ural::indices_of(v))
-    {
-        BOOST_CHECK(std::is_heap(v.begin(), v.begin() + i));
-
-        auto seq = ural::make_iterator_cursor(v.begin(), v.begin()+i+1);
-        auto result = ural::push_heap(seq);
-
-        BOOST_CHECK(result.traversed_front() == seq);
-        BOOST_CHECK(!result);
-        BOOST_CHECK(!result.traversed_back());
-    }
-    BOOST_CHECK(std::is_heap(v.begin(), v.end()));
-}
-
-BOOST_AUTO_TEST_CASE(pop_heap_test)
-{
-    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
-    ural::make_heap(v);
-
-    for(; !ural::empty(v);)
-    {
-        auto const old_top = v.front();
-        auto result = ural::pop_heap(v);
-
-        BOOST_CHECK(result.begin() == result.end());
-        BOOST_CHECK(result.begin() == v.end());
-        BOOST_CHECK(result.traversed_front().begin() == v.begin());
-        BOOST_CHECK(result.traversed_front().end() == v.end());
-
-        BOOST_CHECK_EQUAL(old_top, v.back());
-        v.pop_back();
-        BOOST_CHECK(std::is_heap(v.begin(), v.end()));
-    }
-}
-
-BOOST_AUTO_TEST_CASE(make_heap_test)
-{
-    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
-
-    auto cmp = ural_ex::callable_tracer<ural::less<int>>{};
-    cmp.reset_calls();
-
-    auto result = ural::make_heap(v, cmp);
-
-    BOOST_CHECK(std::is_heap(v.begin(), v.end()));
-
-    BOOST_CHECK_GE(3*v.size(), cmp.calls());
-
-    BOOST_CHECK(result.begin() == result.end());
-    BOOST_CHECK(result.begin() == v.end());
-    BOOST_CHECK(result.traversed_front().begin() == v.begin());
-    BOOST_CHECK(result.traversed_front().end() == v.end());
-}
-
-BOOST_AUTO_TEST_CASE(make_heap_odd_size_test)
-{
-    std::vector<int> v { 3, 1, 4, 1, 5, 9, 2};
-
-    auto cmp = ural_ex::callable_tracer<ural::less<int>>{};
-    cmp.reset_calls();
-
-    auto const result = ural::make_heap(v, cmp);
-
-    BOOST_CHECK(result.traversed_front() == ural::cursor(v));
-    BOOST_CHECK(!result);
-    BOOST_CHECK(!result.traversed_back());
-
-    BOOST_CHECK(std::is_heap(v.begin(), v.end()));
-
-    BOOST_CHECK_GE(3*v.size(), cmp.calls());
-}
-
-BOOST_AUTO_TEST_CASE(sort_heap_test)
-{
-    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
-
-    ural::make_heap(v);
-    auto const result = ural::sort_heap(v);
-
-    BOOST_CHECK(std::is_sorted(v.begin(), v.end()));
-
-    BOOST_CHECK(!result);
-    BOOST_CHECK(::ural::cursor(v) == result.traversed_front());
-}
-
-BOOST_AUTO_TEST_CASE(is_heap_test)
-{
-    std::vector<int> v {3, 1, 4, 1, 5, 9};
-
-    BOOST_CHECK_EQUAL(std::is_heap(v.begin(), v.end()),
-                      ural::is_heap(v));
-}
-
-BOOST_AUTO_TEST_CASE(is_heap_test_all_permutations)
-{
-    std::vector<int> v {1, 2, 3, 4};
-
-    do
-    {
-        BOOST_CHECK_EQUAL(std::is_heap(v.begin(), v.end()), ural::is_heap(v));
-    }
-    while(std::next_permutation(v.begin(), v.end()));
-}
-
-// 25.4.7 Минимум и максимум
-BOOST_AUTO_TEST_CASE(min_max_for_values_test)
-{
-    constexpr auto const v1 = 5;
-    constexpr auto const v2 = 17;
-
-    static_assert(ural::min(v1, v1) == v1, "");
-    static_assert(ural::min(v1, v2) == v1, "");
-    static_assert(ural::min(v2, v1) == v1, "");
-    static_assert(ural::min(v2, v2) == v2, "");
-
-    static_assert(ural::max(v1, v1) == v1, "");
-    static_assert(ural::max(v1, v2) == v2, "");
-    static_assert(ural::max(v2, v1) == v2, "");
-    static_assert(ural::max(v2, v2) == v2, "");
-
-    typedef std::pair<int const &, int const &> Pair;
-
-    static_assert(ural::minmax(v1, v1) == Pair(v1, v1), "");
-    static_assert(ural::minmax(v1, v2) == Pair(v1, v2), "");
-    static_assert(ural::minmax(v2, v1) == Pair(v1, v2), "");
-    static_assert(ural::minmax(v2, v2) == Pair(v2, v2), "");
-
-    BOOST_CHECK(true);
-}
-
-BOOST_AUTO_TEST_CASE(regression_min_max_not_converting_compare_to_function)
-{
-    struct Inner
-    {
-    bool operator==(Inner const & that) const
-    {
-        return this->a == that.a;
-    }
-
-    bool is_lesser(Inner const & that) const
-    {
-        return this->a < that.a;
-    }
-
-    public:
-        int a;
-    };
-
-    auto const one = Inner{1};
-    auto const two = Inner{2};
-
-    BOOST_CHECK(ural::min(one, two, &Inner::is_lesser) == one);
-    BOOST_CHECK(ural::max(one, two, &Inner::is_lesser) == two);
-    BOOST_CHECK(ural::minmax(two, one, &Inner::is_lesser).first == one);
-    BOOST_CHECK(ural::minmax(two, one, &Inner::is_lesser).second == two);
-}
-
-BOOST_AUTO_TEST_CASE(min_max_stability_test)
-{
-    auto const v1 = 'a';
-    auto const v2 = 'A';
-
-    auto cmp = [](char x, char y) { return std::toupper(x) < std::toupper(y); };
-
-    BOOST_CHECK_EQUAL(ural::min(v1, v2, cmp), v1);
-    BOOST_CHECK_EQUAL(ural::min(v2, v1, cmp), v2);
-
-    BOOST_CHECK_EQUAL(ural::max(v1, v2, cmp), v1);
-    BOOST_CHECK_EQUAL(ural::max(v2, v1, cmp), v2);
-
-    BOOST_CHECK_EQUAL(ural::minmax(v1, v2, cmp).first, v1);
-    BOOST_CHECK_EQUAL(ural::minmax(v1, v2, cmp).second, v2);
-
-    BOOST_CHECK_EQUAL(ural::minmax(v2, v1, cmp).first, v2);
-    BOOST_CHECK_EQUAL(ural::minmax(v2, v1, cmp).second, v1);
-}
-
-BOOST_AUTO_TEST_CASE(min_max_for_init_list_test)
-{
-    constexpr auto const r = ::ural::min({3, 1, 4, 1, 5, 9, 2});
-    constexpr auto const R = ::ural::max({3, 1, 4, 1, 5, 9, 2});
-    constexpr auto const rR = ::ural::minmax({3, 1, 4, 1, 5, 9, 2});
-
-    static_assert(r == 1, "");
-    static_assert(R == 9, "");
-    static_assert(rR.first == 1, "");
-    static_assert(rR.second == 9, "");
-
-    std::initializer_list<int> e;
-
-    BOOST_CHECK_THROW(::ural::min(e), std::logic_error);
-    BOOST_CHECK_THROW(::ural::max(e), std::logic_error);
-    BOOST_CHECK_THROW(::ural::minmax(e), std::logic_error);
-}
-
-BOOST_AUTO_TEST_CASE(min_max_for_init_list_stability)
-{
-     auto cmp = [](char x, char y) { return std::toupper(x) < std::toupper(y); };
-
-    auto const r = ::ural::min({'c', 'a', 'd', 'A', 'E', 'Z', 'B'}, cmp);
-    auto const R = ::ural::max({'c', 'a', 'd', 'A', 'E', 'Z', 'B'}, cmp);
-    auto const rR = ::ural::minmax({'c', 'a', 'd', 'A', 'E', 'Z', 'B'}, cmp);
-
-    BOOST_CHECK_EQUAL(r, 'a');
-    BOOST_CHECK_EQUAL(R, 'Z');
-    BOOST_CHECK_EQUAL(rR.first, 'a');
-    BOOST_CHECK_EQUAL(rR.second, 'Z');
-
-    std::initializer_list<char> e;
-
-    BOOST_CHECK_THROW(::ural::min(e, cmp), std::logic_error);
-    BOOST_CHECK_THROW(::ural::max(e, cmp), std::logic_error);
-    BOOST_CHECK_THROW(::ural::minmax(e, cmp), std::logic_error);
-}
-
-// @todo перегрузки min/max/minmax для интервалов
-
-BOOST_AUTO_TEST_CASE(min_element_test)
-{
-    std::forward_list<int> const v{3, 1, 4, 1, 5, 9, 2, 6, 5};
-
-    auto std_result = std::min_element(std::begin(v), std::end(v));
-    auto ural_result = ural::min_element(v);
-
-    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
-                      ural::size(ural_result));
-    BOOST_CHECK(!!ural_result);
-    BOOST_CHECK_EQUAL(*std_result, *ural_result);
-}
-
-BOOST_AUTO_TEST_CASE(max_element_test)
-{
-    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
-    auto std_result = std::max_element(v.begin(), v.end());
-    auto ural_result = ural::max_element(v);
-
-    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
-                      ural::size(ural_result));
-}
-
-BOOST_AUTO_TEST_CASE(max_element_test_custom_compare)
-{
-    auto abs_compare = [](int a, int b) {return (std::abs(a) < std::abs(b));};
-
-    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
-    auto std_result = std::max_element(v.begin(), v.end(), +abs_compare);
-    auto ural_result = ural::max_element(v, +abs_compare);
-
-    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
-                      ural::size(ural_result));
-}
-
-#include <ural/math.hpp>
-
-BOOST_AUTO_TEST_CASE(max_element_using_compare_by)
-{
-    auto const sq_cmp = ural::experimental::compare_by(ural::square);
-
-    static_assert(std::is_empty<decltype(sq_cmp)>::value, "Must be empty!");
-
-    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
-    auto std_result = std::max_element(v.begin(), v.end(), sq_cmp);
-    auto ural_result = ural::max_element(v, sq_cmp);
-
-    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
-                      ural::size(ural_result));
-}
-
-BOOST_AUTO_TEST_CASE(minmax_element_test)
-{
-    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
-    auto std_result = std::minmax_element(v.begin(), v.end());
-    auto ural_result = ural::minmax_element(v);
-
-    BOOST_CHECK_EQUAL(std::distance(std_result.first, v.end()),
-                      ural::size(ural_result[ural::_1]));
-    BOOST_CHECK_EQUAL(std::distance(std_result.second, v.end()),
-                      ural::size(ural_result[ural::_2]));
-}
-
-// 25.4.8 Лексикографическое сравнение
-BOOST_AUTO_TEST_CASE(lexicographical_compare_test)
-{
-    typedef std::istringstream S;
-    S is0_1("");
-    S is0_2("");
-    S ab("ab");
-    S abc("abc");
-
-    BOOST_CHECK_EQUAL(false, ural::lexicographical_compare(is0_1, is0_2));
-
-    BOOST_CHECK_EQUAL(true, ural::lexicographical_compare(ab, abc));
-    BOOST_CHECK_EQUAL(false, ural::lexicographical_compare("abc", "ab"));
-
-    BOOST_CHECK_EQUAL(true, ural::lexicographical_compare("abcd", "abed"));
-    BOOST_CHECK_EQUAL(false, ural::lexicographical_compare("abed", "abcd"));
-}
-
-// 25.4.9 Порождение перестановок
-BOOST_AUTO_TEST_CASE(next_permutation_test)
-{
-    typedef std::list<int> String;
-    String x {1, 2, 3, 4};
-    std::vector<String> r_std;
-
-    do
-    {
-        r_std.push_back(x);
-    }
-    while(std::next_permutation(x.begin(), x.end()));
-
-    std::vector<String> r_ural;
-
-    do
-    {
-        r_ural.push_back(x);
-    }
-    while(ural::next_permutation(x));
-
-    BOOST_CHECK(r_std == r_ural);
-}
-
-BOOST_AUTO_TEST_CASE(prev_permutation_test)
-{
-    typedef std::list<int> String;
-    String x {4, 3, 2, 1};
-    std::vector<String> r_std;
-
-    do
-    {
-        r_std.push_back(x);
-    }
-    while(std::prev_permutation(x.begin(), x.end()));
-
-    std::vector<String> r_ural;
-
-    do
-    {
-        r_ural.push_back(x);
-    }
-    while(ural::prev_permutation(x));
-
-    BOOST_CHECK(r_std == r_ural);
-}
+    }
+}
+
+BOOST_AUTO_TEST_CASE(includes_test_custom_compare_istream_auto_to_cursor)
+{
+    std::vector<std::string> vs{"abcfhx", "abc", "ac", "g", "acg", {}};
+    std::string v_0 {"ABC"};
+
+    auto cmp_nocase = [](char a, char b) {
+    return std::tolower(a) < std::tolower(b);
+    };
+
+    for(auto const & s : vs)
+    {
+        bool const r_std = std::includes(s.begin(), s.end(),
+                                         v_0.begin(), v_0.end(), cmp_nocase);
+        std::istringstream s_stream(s);
+        std::istringstream v_0_stream(v_0);
+
+        bool const r_ural = ural::includes(s_stream, v_0_stream, cmp_nocase);
+        BOOST_CHECK_EQUAL(r_std, r_ural);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(set_union_test)
+{
+    std::istringstream is1("1 2 3 4 5");
+    std::istringstream is2("    3 4 5 6 7");
+
+    std::vector<int> const z {1, 2, 3, 4, 5, 6, 7};
+
+    std::vector<int> r_ural;
+    ural::set_union(ural::experimental::make_istream_cursor<int>(is1),
+                    ural::experimental::make_istream_cursor<int>(is2),
+                    r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_union_test_shorter_in_1)
+{
+    std::vector<int> const is1{1, 2, 3, 4, 5,};
+    std::vector<int> const is2{      3, 4, 5, 6, 7};
+    std::vector<int> const z  {1, 2, 3, 4, 5, 6, 7};
+
+    BOOST_CHECK_LE(is1.back(), is2.back());
+
+    std::vector<int> r_ural;
+    auto result = ural::set_union(is1, is2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+
+    BOOST_CHECK(!result[ural::_1]);
+    BOOST_CHECK(!result[ural::_2]);
+    BOOST_CHECK(!!result[ural::_3]);
+}
+
+BOOST_AUTO_TEST_CASE(set_union_test_shorter_in_2)
+{
+    std::vector<int> const is1{1, 2, 3, 4, 5,    7};
+    std::vector<int> const is2{      3, 4, 5, 6};
+    std::vector<int> const z  {1, 2, 3, 4, 5, 6, 7};
+
+    BOOST_CHECK_LE(is2.back(), is1.back());
+
+    std::vector<int> r_ural;
+    auto result = ural::set_union(is1, is2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+
+    BOOST_CHECK(!result[ural::_1]);
+    BOOST_CHECK(!result[ural::_2]);
+    BOOST_CHECK(!!result[ural::_3]);
+}
+
+BOOST_AUTO_TEST_CASE(set_union_test_shorter_out)
+{
+    std::vector<int> const is1{1, 2, 3, 4, 5,};
+    std::vector<int> const is2{      3, 4, 5, 6, 7};
+    std::vector<int> const z  {1, 2, 3, 4, 5, 6, 7};
+
+    std::vector<int> r_ural(z.size() / 2, -1);
+    BOOST_CHECK_LE(r_ural.size(), z.size());
+    BOOST_CHECK(r_ural.empty() == false);
+
+    auto result = ural::set_union(is1, is2, r_ural);
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
+                                  z.begin(), z.begin() + r_ural.size());
+
+    BOOST_CHECK(!!result[ural::_1]);
+    BOOST_CHECK(!!result[ural::_2]);
+    BOOST_CHECK(!result[ural::_3]);
+
+    BOOST_CHECK(result[ural::_1].original() == ural::cursor(is1));
+    BOOST_CHECK(result[ural::_2].original() == ural::cursor(is2));
+    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
+
+    std::vector<int> r_std;
+    std::set_union(result[ural::_1].traversed_begin(),
+                   result[ural::_1].begin(),
+                   result[ural::_2].traversed_begin(),
+                   result[ural::_2].begin(),
+                   std::back_inserter(r_std));
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
+                                  r_std.begin(), r_std.end());
+}
+
+BOOST_AUTO_TEST_CASE(set_intersection_test)
+{
+    std::istringstream is1("1 2 3 4 5");
+    std::istringstream is2("  2   4 5 6 7");
+
+    std::vector<int> const z {2, 4, 5};
+
+    std::vector<int> r_ural;
+    ural::set_intersection(ural::experimental::make_istream_cursor<int>(is1),
+                           ural::experimental::make_istream_cursor<int>(is2),
+                           r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_intersection_test_shorter_in_1)
+{
+    std::vector<int> const is1{1, 2, 3, 4, 5};
+    std::vector<int> const is2{   2,    4, 5, 6, 7};
+    std::vector<int> const z  {   2,    4, 5};
+
+    BOOST_CHECK_LE(is1.size(), is2.size());
+    BOOST_CHECK_LE(is1.back(), is2.back());
+
+    std::vector<int> r_ural;
+    auto result = ural::set_intersection(is1, is2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+
+    BOOST_CHECK(!result[ural::_1]);
+
+    BOOST_CHECK(!!result[ural::_2]);
+    BOOST_CHECK_LE(z.back(), result[ural::_2].front());
+
+    BOOST_CHECK_EQUAL(is1.back(), result[ural::_2].front());
+
+    BOOST_CHECK(!!result[ural::_3]);
+}
+
+BOOST_AUTO_TEST_CASE(set_intersection_test_shorter_in_2)
+{
+    std::vector<int> const is1{   2, 3, 4, 5, 6, 7};
+    std::vector<int> const is2{1, 2,    4, 5};
+    std::vector<int> const z  {   2,    4, 5};
+
+    BOOST_CHECK_LE(is2.size(), is1.size());
+    BOOST_CHECK_LE(is2.back(), is1.back());
+
+    std::vector<int> r_ural;
+    auto result = ural::set_intersection(is1, is2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+
+    BOOST_CHECK(!!result[ural::_1]);
+    BOOST_CHECK(!result[ural::_2]);
+    BOOST_CHECK(!!result[ural::_3]);
+
+    BOOST_CHECK_LE(z.back(), result[ural::_1].front());
+
+    BOOST_CHECK_EQUAL(result[ural::_1].front(),
+                      ural::upper_bound(is1, is2.back()).front());
+}
+
+BOOST_AUTO_TEST_CASE(set_intersection_test_shorter_out)
+{
+    std::vector<int> const is1{   2, 3, 4, 5, 6, 7};
+    std::vector<int> const is2{1, 2,    4, 5};
+    std::vector<int> const z  {   2,    4, 5};
+
+    std::vector<int> r_ural(z.size() / 2, -1);
+    BOOST_CHECK_LE(r_ural.size(), z.size());
+    BOOST_CHECK(r_ural.empty() == false);
+
+    auto result = ural::set_intersection(is1, is2, r_ural);
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
+                                  z.begin(), z.begin() + r_ural.size());
+
+    BOOST_CHECK(!!result[ural::_1]);
+    BOOST_CHECK(!!result[ural::_2]);
+    BOOST_CHECK(!result[ural::_3]);
+
+    BOOST_CHECK(result[ural::_1].original() == ural::cursor(is1));
+    BOOST_CHECK(result[ural::_2].original() == ural::cursor(is2));
+    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
+
+    std::vector<int> r_std;
+    std::set_intersection(result[ural::_1].traversed_begin(),
+                          result[ural::_1].begin(),
+                          result[ural::_2].traversed_begin(),
+                          result[ural::_2].begin(),
+                          std::back_inserter(r_std));
+
+    URAL_CHECK_EQUAL_RANGES(r_ural, r_std);
+}
+
+BOOST_AUTO_TEST_CASE(set_difference_test)
+{
+    typedef ural_test::istringstream_helper<int> Source;
+    Source const is1            {1, 2, 3, 4, 5,      8};
+    Source const is2            {   2,    4, 5, 6, 7  };
+    std::vector<int> const z    {1,    3,            8};
+
+    std::vector<int> r_ural;
+    ural::set_difference(is1, is2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_difference_test_unexhausted_2)
+{
+    typedef ural_test::istringstream_helper<int> Source;
+    Source const is1            {1, 2, 3, 4, 5,      8};
+    Source const is2            {   2,    4, 5, 6, 7,  9};
+    std::vector<int> const z    {1,    3,            8};
+
+    std::vector<int> r_ural;
+    ural::set_difference(is1, is2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_difference_test_to_short)
+{
+    std::vector<int> is1     {1, 2, 3, 4, 5,       8};
+    std::vector<int> is2     {   2,    4, 5, 6, 7,   9};
+    std::vector<int> const z {1,    3,             8};
+
+    std::vector<int> r_ural(z.size() / 2, -1);
+
+    auto result = ural::set_difference(is1, is2, r_ural);
+
+    BOOST_CHECK(result[ural::_1].original() == ural::cursor(is1));
+    BOOST_CHECK(!!result[ural::_1]);
+    BOOST_CHECK_LE(r_ural.back(), result[ural::_1].front());
+
+    BOOST_CHECK(result[ural::_2].original() == ural::cursor(is2));
+    BOOST_CHECK(!!result[ural::_2]);
+    BOOST_CHECK_LE(r_ural.back(), result[ural::_2].front());
+
+    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
+    BOOST_CHECK(!result[ural::_3]);
+
+    assert(r_ural.size() < z.size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
+                                  z.begin(), z.begin() + r_ural.size());
+
+    std::vector<int> r_std;
+    std::set_difference(result[ural::_1].traversed_begin(),
+                        result[ural::_1].begin(),
+                        result[ural::_2].traversed_begin(),
+                        result[ural::_2].begin(),
+                        r_std | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(r_ural, r_std);
+}
+
+BOOST_AUTO_TEST_CASE(set_symmetric_difference_test)
+{
+    using Source = ural_test::istringstream_helper<int>;
+
+    Source const x1          {1, 2, 3, 4, 5, 6, 7, 8       };
+    Source const x2          {            5,    7,    9, 10};
+    std::vector<int> const z {1, 2, 3, 4,    6,    8, 9, 10};
+
+    // через back_inserter
+    std::vector<int> r_ural;
+    ural::set_symmetric_difference(x1, x2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_symmetric_difference_regression)
+{
+    std::vector<int> const x1{1, 2, 3, 4, 5,       8};
+    std::vector<int> const x2{   2,    4, 5, 6, 7   };
+    std::vector<int> const z {1,    3,       6, 7, 8};
+
+    BOOST_CHECK_GE(x1.back(), x2.back());
+
+    std::vector<int> r_ural;
+    ural::set_symmetric_difference(x1, x2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_symmetric_difference_from_istream)
+{
+    using Source = ural_test::istringstream_helper<int>;
+
+    Source const x1          {1, 2, 3, 4, 5, 6, 7, 8       };
+    Source const x2          {            5,    7,    9, 10};
+    std::vector<int> const z {1, 2, 3, 4,    6,    8, 9, 10};
+
+    std::vector<int> r_ural;
+    ural::set_symmetric_difference(x1, x2, r_ural | ural::back_inserter);
+
+    URAL_CHECK_EQUAL_RANGES(z, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_symmetric_difference_to_short)
+{
+    std::vector<int> const x1{1, 2, 3, 4, 5,       8};
+    std::vector<int> const x2{   2,    4, 5, 6, 7   };
+    std::vector<int> const z {1,    3,       6, 7, 8};
+
+    std::vector<int> r_ural(z.size() / 2, - 1);
+
+    assert(!r_ural.empty());
+    assert(r_ural.size() < z.size());
+
+    auto result = ural::set_symmetric_difference(x1, x2, r_ural);
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(r_ural.begin(), r_ural.end(),
+                                  z.begin(), z.begin() + r_ural.size());
+
+    BOOST_CHECK(result[ural::_1].original() == ural::cursor(x1));
+    BOOST_CHECK(!!result[ural::_1]);
+    BOOST_CHECK_LE(r_ural.back(), result[ural::_1].front());
+
+    BOOST_CHECK(result[ural::_2].original() == ural::cursor(x2));
+    BOOST_CHECK(!!result[ural::_2]);
+    BOOST_CHECK_LE(r_ural.back(), result[ural::_2].front());
+
+    BOOST_CHECK(result[ural::_3].original() == ural::cursor(r_ural));
+    BOOST_CHECK(!result[ural::_3]);
+
+    std::vector<int> r_std;
+    std::set_symmetric_difference(result[ural::_1].traversed_begin(),
+                                  result[ural::_1].begin(),
+                                  result[ural::_2].traversed_begin(),
+                                  result[ural::_2].begin(),
+                                  std::back_inserter(r_std));
+    URAL_CHECK_EQUAL_RANGES(r_ural, r_std);
+}
+
+BOOST_AUTO_TEST_CASE(regression_33_set_operations_first_base)
+{
+    std::list<int> const x1{1, 2, 3, 4, 5,       8};
+    std::vector<int> const x2{   2,    4, 5, 6, 7   };
+
+    std::forward_list<int> out;
+
+    auto r_union = ural::set_union(x1, x2, out);
+    BOOST_CHECK(r_union[ural::_1].original() == ural::cursor(x1));
+    BOOST_CHECK(r_union[ural::_2].original() == ural::cursor(x2));
+
+    auto r_inter = ural::set_intersection(x1, x2, out);
+    BOOST_CHECK(r_inter[ural::_1].original() == ural::cursor(x1));
+    BOOST_CHECK(r_inter[ural::_2].original() == ural::cursor(x2));
+
+    auto r_diff  = ural::set_difference(x1, x2, out);
+    BOOST_CHECK(r_diff[ural::_1].original() == ural::cursor(x1));
+    BOOST_CHECK(r_diff[ural::_2].original() == ural::cursor(x2));
+
+    auto r_sdiff = ural::set_symmetric_difference(x1, x2, out);
+    BOOST_CHECK(r_sdiff[ural::_1].original() == ural::cursor(x1));
+    BOOST_CHECK(r_sdiff[ural::_2].original() == ural::cursor(x2));
+}
+
+// 25.4.6 Операции с бинарными кучами
+BOOST_AUTO_TEST_CASE(push_heap_test)
+{
+    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
+
+    for(auto i : ural::indices_of(v))
+    {
+        BOOST_CHECK(std::is_heap(v.begin(), v.begin() + i));
+
+        auto seq = ural::make_iterator_cursor(v.begin(), v.begin()+i+1);
+        auto result = ural::push_heap(seq);
+
+        BOOST_CHECK(result.traversed_front() == seq);
+        BOOST_CHECK(!result);
+        BOOST_CHECK(!result.traversed_back());
+    }
+    BOOST_CHECK(std::is_heap(v.begin(), v.end()));
+}
+
+BOOST_AUTO_TEST_CASE(pop_heap_test)
+{
+    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
+    ural::make_heap(v);
+
+    for(; !ural::empty(v);)
+    {
+        auto const old_top = v.front();
+        auto result = ural::pop_heap(v);
+
+        BOOST_CHECK(result.begin() == result.end());
+        BOOST_CHECK(result.begin() == v.end());
+        BOOST_CHECK(result.traversed_front().begin() == v.begin());
+        BOOST_CHECK(result.traversed_front().end() == v.end());
+
+        BOOST_CHECK_EQUAL(old_top, v.back());
+        v.pop_back();
+        BOOST_CHECK(std::is_heap(v.begin(), v.end()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(make_heap_test)
+{
+    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
+
+    auto cmp = ural_ex::callable_tracer<ural::less<int>>{};
+    cmp.reset_calls();
+
+    auto result = ural::make_heap(v, cmp);
+
+    BOOST_CHECK(std::is_heap(v.begin(), v.end()));
+
+    BOOST_CHECK_GE(3*v.size(), cmp.calls());
+
+    BOOST_CHECK(result.begin() == result.end());
+    BOOST_CHECK(result.begin() == v.end());
+    BOOST_CHECK(result.traversed_front().begin() == v.begin());
+    BOOST_CHECK(result.traversed_front().end() == v.end());
+}
+
+BOOST_AUTO_TEST_CASE(make_heap_odd_size_test)
+{
+    std::vector<int> v { 3, 1, 4, 1, 5, 9, 2};
+
+    auto cmp = ural_ex::callable_tracer<ural::less<int>>{};
+    cmp.reset_calls();
+
+    auto const result = ural::make_heap(v, cmp);
+
+    BOOST_CHECK(result.traversed_front() == ural::cursor(v));
+    BOOST_CHECK(!result);
+    BOOST_CHECK(!result.traversed_back());
+
+    BOOST_CHECK(std::is_heap(v.begin(), v.end()));
+
+    BOOST_CHECK_GE(3*v.size(), cmp.calls());
+}
+
+BOOST_AUTO_TEST_CASE(sort_heap_test)
+{
+    std::vector<int> v { 3, 1, 4, 1, 5, 9 };
+
+    ural::make_heap(v);
+    auto const result = ural::sort_heap(v);
+
+    BOOST_CHECK(std::is_sorted(v.begin(), v.end()));
+
+    BOOST_CHECK(!result);
+    BOOST_CHECK(::ural::cursor(v) == result.traversed_front());
+}
+
+BOOST_AUTO_TEST_CASE(is_heap_test)
+{
+    std::vector<int> v {3, 1, 4, 1, 5, 9};
+
+    BOOST_CHECK_EQUAL(std::is_heap(v.begin(), v.end()),
+                      ural::is_heap(v));
+}
+
+BOOST_AUTO_TEST_CASE(is_heap_test_all_permutations)
+{
+    std::vector<int> v {1, 2, 3, 4};
+
+    do
+    {
+        BOOST_CHECK_EQUAL(std::is_heap(v.begin(), v.end()), ural::is_heap(v));
+    }
+    while(std::next_permutation(v.begin(), v.end()));
+}
+
+// 25.4.7 Минимум и максимум
+BOOST_AUTO_TEST_CASE(min_max_for_values_test)
+{
+    constexpr auto const v1 = 5;
+    constexpr auto const v2 = 17;
+
+    static_assert(ural::min(v1, v1) == v1, "");
+    static_assert(ural::min(v1, v2) == v1, "");
+    static_assert(ural::min(v2, v1) == v1, "");
+    static_assert(ural::min(v2, v2) == v2, "");
+
+    static_assert(ural::max(v1, v1) == v1, "");
+    static_assert(ural::max(v1, v2) == v2, "");
+    static_assert(ural::max(v2, v1) == v2, "");
+    static_assert(ural::max(v2, v2) == v2, "");
+
+    typedef std::pair<int const &, int const &> Pair;
+
+    static_assert(ural::minmax(v1, v1) == Pair(v1, v1), "");
+    static_assert(ural::minmax(v1, v2) == Pair(v1, v2), "");
+    static_assert(ural::minmax(v2, v1) == Pair(v1, v2), "");
+    static_assert(ural::minmax(v2, v2) == Pair(v2, v2), "");
+
+    BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE(regression_min_max_not_converting_compare_to_function)
+{
+    struct Inner
+    {
+    bool operator==(Inner const & that) const
+    {
+        return this->a == that.a;
+    }
+
+    bool is_lesser(Inner const & that) const
+    {
+        return this->a < that.a;
+    }
+
+    public:
+        int a;
+    };
+
+    auto const one = Inner{1};
+    auto const two = Inner{2};
+
+    BOOST_CHECK(ural::min(one, two, &Inner::is_lesser) == one);
+    BOOST_CHECK(ural::max(one, two, &Inner::is_lesser) == two);
+    BOOST_CHECK(ural::minmax(two, one, &Inner::is_lesser).first == one);
+    BOOST_CHECK(ural::minmax(two, one, &Inner::is_lesser).second == two);
+}
+
+BOOST_AUTO_TEST_CASE(min_max_stability_test)
+{
+    auto const v1 = 'a';
+    auto const v2 = 'A';
+
+    auto cmp = [](char x, char y) { return std::toupper(x) < std::toupper(y); };
+
+    BOOST_CHECK_EQUAL(ural::min(v1, v2, cmp), v1);
+    BOOST_CHECK_EQUAL(ural::min(v2, v1, cmp), v2);
+
+    BOOST_CHECK_EQUAL(ural::max(v1, v2, cmp), v1);
+    BOOST_CHECK_EQUAL(ural::max(v2, v1, cmp), v2);
+
+    BOOST_CHECK_EQUAL(ural::minmax(v1, v2, cmp).first, v1);
+    BOOST_CHECK_EQUAL(ural::minmax(v1, v2, cmp).second, v2);
+
+    BOOST_CHECK_EQUAL(ural::minmax(v2, v1, cmp).first, v2);
+    BOOST_CHECK_EQUAL(ural::minmax(v2, v1, cmp).second, v1);
+}
+
+BOOST_AUTO_TEST_CASE(min_max_for_init_list_test)
+{
+    constexpr auto const r = ::ural::min({3, 1, 4, 1, 5, 9, 2});
+    constexpr auto const R = ::ural::max({3, 1, 4, 1, 5, 9, 2});
+    constexpr auto const rR = ::ural::minmax({3, 1, 4, 1, 5, 9, 2});
+
+    static_assert(r == 1, "");
+    static_assert(R == 9, "");
+    static_assert(rR.first == 1, "");
+    static_assert(rR.second == 9, "");
+
+    std::initializer_list<int> e;
+
+    BOOST_CHECK_THROW(::ural::min(e), std::logic_error);
+    BOOST_CHECK_THROW(::ural::max(e), std::logic_error);
+    BOOST_CHECK_THROW(::ural::minmax(e), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(min_max_for_init_list_stability)
+{
+     auto cmp = [](char x, char y) { return std::toupper(x) < std::toupper(y); };
+
+    auto const r = ::ural::min({'c', 'a', 'd', 'A', 'E', 'Z', 'B'}, cmp);
+    auto const R = ::ural::max({'c', 'a', 'd', 'A', 'E', 'Z', 'B'}, cmp);
+    auto const rR = ::ural::minmax({'c', 'a', 'd', 'A', 'E', 'Z', 'B'}, cmp);
+
+    BOOST_CHECK_EQUAL(r, 'a');
+    BOOST_CHECK_EQUAL(R, 'Z');
+    BOOST_CHECK_EQUAL(rR.first, 'a');
+    BOOST_CHECK_EQUAL(rR.second, 'Z');
+
+    std::initializer_list<char> e;
+
+    BOOST_CHECK_THROW(::ural::min(e, cmp), std::logic_error);
+    BOOST_CHECK_THROW(::ural::max(e, cmp), std::logic_error);
+    BOOST_CHECK_THROW(::ural::minmax(e, cmp), std::logic_error);
+}
+
+// @todo перегрузки min/max/minmax для интервалов
+
+BOOST_AUTO_TEST_CASE(min_element_test)
+{
+    std::forward_list<int> const v{3, 1, 4, 1, 5, 9, 2, 6, 5};
+
+    auto std_result = std::min_element(std::begin(v), std::end(v));
+    auto ural_result = ural::min_element(v);
+
+    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
+                      ural::size(ural_result));
+    BOOST_CHECK(!!ural_result);
+    BOOST_CHECK_EQUAL(*std_result, *ural_result);
+}
+
+BOOST_AUTO_TEST_CASE(max_element_test)
+{
+    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
+    auto std_result = std::max_element(v.begin(), v.end());
+    auto ural_result = ural::max_element(v);
+
+    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
+                      ural::size(ural_result));
+}
+
+BOOST_AUTO_TEST_CASE(max_element_test_custom_compare)
+{
+    auto abs_compare = [](int a, int b) {return (std::abs(a) < std::abs(b));};
+
+    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
+    auto std_result = std::max_element(v.begin(), v.end(), +abs_compare);
+    auto ural_result = ural::max_element(v, +abs_compare);
+
+    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
+                      ural::size(ural_result));
+}
+
+#include <ural/math.hpp>
+
+BOOST_AUTO_TEST_CASE(max_element_using_compare_by)
+{
+    auto const sq_cmp = ural::experimental::compare_by(ural::square);
+
+    static_assert(std::is_empty<decltype(sq_cmp)>::value, "Must be empty!");
+
+    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
+    auto std_result = std::max_element(v.begin(), v.end(), sq_cmp);
+    auto ural_result = ural::max_element(v, sq_cmp);
+
+    BOOST_CHECK_EQUAL(std::distance(std_result, v.end()),
+                      ural::size(ural_result));
+}
+
+BOOST_AUTO_TEST_CASE(minmax_element_test)
+{
+    std::forward_list<int> const v{ 3, 1, -14, 1, 5, 9 };
+    auto std_result = std::minmax_element(v.begin(), v.end());
+    auto ural_result = ural::minmax_element(v);
+
+    BOOST_CHECK_EQUAL(std::distance(std_result.first, v.end()),
+                      ural::size(ural_result[ural::_1]));
+    BOOST_CHECK_EQUAL(std::distance(std_result.second, v.end()),
+                      ural::size(ural_result[ural::_2]));
+}
+
+BOOST_AUTO_TEST_CASE(minmax_element_test_equal_pairs)
+{
+    std::forward_list<int> const v{5, 0, 0, 7, 7, 3, 9, 9, 0, 9, 9};
+
+    auto const std_min = std::min_element(v.begin(), v.end());
+    auto const std_max = std::max_element(v.begin(), v.end());
+
+    auto const ural_result = ural::minmax_element(v);
+
+    BOOST_CHECK_EQUAL(std::distance(std_min, v.end()),
+                      ural::size(ural_result[ural::_1]));
+    BOOST_CHECK_EQUAL(std::distance(std_max, v.end()),
+                      ural::size(ural_result[ural::_2]));
+}
+
+BOOST_AUTO_TEST_CASE(minmax_element_test_comparisons_count)
+{
+    std::vector<int> v(1001);
+    std::uniform_int_distribution<int> d(-50, 50);
+
+    for(auto & x : v)
+    {
+        x = d(ural_test::random_engine());
+    }
+
+    std::forward_list<int> const src(v.begin(), v.end());
+
+    std::size_t count = 0;
+    auto const cmp = [&count](int x, int y) { ++ count; return x < y; };
+
+    auto const ural_result = ural::minmax_element(src, cmp);
+
+    BOOST_CHECK_LE(count, 3 * v.size() / 2);
+
+    BOOST_CHECK_EQUAL(v.end() - std::min_element(v.begin(), v.end()),
+                      ural::size(ural_result[ural::_1]));
+    BOOST_CHECK_EQUAL(v.end() - std::max_element(v.begin(), v.end()),
+                      ural::size(ural_result[ural::_2]));
+}
+
+namespace
+{
+    typedef boost::mpl::list<float, double> Floating_point_types;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(min_max_element_test_contiguous,
+                              Value, Ordered_arithmetic_types)
+{
+    std::uniform_int_distribution<int> d(0, 5);
+
+    for(auto n : {1, 2, 7, 15, 16, 17, 33, 64, 100, 257})
+    for(auto offset : {0, 1, 3})
+    {
+        std::vector<Value> v(n + offset);
+
+        for(auto & x : v)
+        {
+            // Много повторов, в том числе наибольших и наименьших значений
+            x = static_cast<Value>(d(ural_test::random_engine()) * 20 - 50);
+        }
+
+        auto const first = v.begin() + offset;
+
+        auto const std_min = std::min_element(first, v.end());
+        auto const std_max = std::max_element(first, v.end());
+
+        auto const seq = ural::make_iterator_cursor(first, v.end());
+
+        BOOST_CHECK(ural::min_element(seq).begin() == std_min);
+        BOOST_CHECK(ural::max_element(seq).begin() == std_max);
+
+        auto const r = ural::minmax_element(seq);
+
+        BOOST_CHECK(r[ural::_1].begin() == std_min);
+        BOOST_CHECK(r[ural::_2].begin() == std_max);
+    }
+
+    std::vector<Value> const e;
+
+    BOOST_CHECK(!ural::min_element(e));
+    BOOST_CHECK(!ural::max_element(e));
+    BOOST_CHECK(!ural::minmax_element(e)[ural::_1]);
+    BOOST_CHECK(!ural::minmax_element(e)[ural::_2]);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(min_max_element_test_nan, Value, Floating_point_types)
+{
+    auto const nan = std::numeric_limits<Value>::quiet_NaN();
+
+    for(auto n : {1, 2, 9, 40})
+    for(auto pos : {0, 1, 5, 20, 39})
+    {
+        std::vector<Value> v(n);
+
+        for(auto i = 0; i < n; ++ i)
+        {
+            v[i] = static_cast<Value>((i * 7) % 11) - Value(5);
+        }
+
+        if(n > 3)
+        {
+            v[n - 2] = Value(-0.0);
+            v[n - 1] = Value(0.0);
+        }
+
+        if(pos < n)
+        {
+            v[pos] = nan;
+        }
+
+        auto const std_min = std::min_element(v.begin(), v.end());
+        auto const std_max = std::max_element(v.begin(), v.end());
+
+        BOOST_CHECK(ural::min_element(v).begin() == std_min);
+        BOOST_CHECK(ural::max_element(v).begin() == std_max);
+
+        auto const r = ural::minmax_element(v);
+
+        BOOST_CHECK(r[ural::_1].begin() == std_min);
+        BOOST_CHECK(r[ural::_2].begin() == std_max);
+    }
+}
+
+// 25.4.8 Лексикографическое сравнение
+BOOST_AUTO_TEST_CASE(lexicographical_compare_test)
+{
+    typedef std::istringstream S;
+    S is0_1("");
+    S is0_2("");
+    S ab("ab");
+    S abc("abc");
+
+    BOOST_CHECK_EQUAL(false, ural::lexicographical_compare(is0_1, is0_2));
+
+    BOOST_CHECK_EQUAL(true, ural::lexicographical_compare(ab, abc));
+    BOOST_CHECK_EQUAL(false, ural::lexicographical_compare("abc", "ab"));
+
+    BOOST_CHECK_EQUAL(true, ural::lexicographical_compare("abcd", "abed"));
+    BOOST_CHECK_EQUAL(false, ural::lexicographical_compare("abed", "abcd"));
+}
+
+namespace
+{
+    typedef boost::mpl::list<char, signed char, unsigned char, short,
+                             unsigned int, long long>
+        Lexicographical_compare_types;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(lexicographical_compare_test_contiguous,
+                              Value, Lexicographical_compare_types)
+{
+    std::vector<Value> x;
+
+    for(auto i = 0; i < 70; ++ i)
+    {
+        x.push_back(static_cast<Value>(i % 2 == 0 ? -i : i));
+    }
+
+    for(auto n : {0, 1, 16, 17, 69, 70})
+    for(auto pos : {0, 5, 32, 68})
+    for(auto delta : {-100, 100})
+    {
+        auto y = x;
+        y.resize(n);
+
+        if(pos < n)
+        {
+            y[pos] = static_cast<Value>(y[pos] + delta);
+        }
+
+        BOOST_CHECK_EQUAL(ural::lexicographical_compare(x, y),
+                          std::lexicographical_compare(x.begin(), x.end(),
+                                                       y.begin(), y.end()));
+        BOOST_CHECK_EQUAL(ural::lexicographical_compare(y, x),
+                          std::lexicographical_compare(y.begin(), y.end(),
+                                                       x.begin(), x.end()));
+    }
+}
+
+// 25.4.9 Порождение перестановок
+BOOST_AUTO_TEST_CASE(next_permutation_test)
+{
+    typedef std::list<int> String;
+    String x {1, 2, 3, 4};
+    std::vector<String> r_std;
+
+    do
+    {
+        r_std.push_back(x);
+    }
+    while(std::next_permutation(x.begin(), x.end()));
+
+    std::vector<String> r_ural;
+
+    do
+    {
+        r_ural.push_back(x);
+    }
+    while(ural::next_permutation(x));
+
+    BOOST_CHECK(r_std == r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(prev_permutation_test)
+{
+    typedef std::list<int> String;
+    String x {4, 3, 2, 1};
+    std::vector<String> r_std;
+
+    do
+    {
+        r_std.push_back(x);
+    }
+    while(std::prev_permutation(x.begin(), x.end()));
+
+    std::vector<String> r_ural;
+
+    do
+    {
+        r_ural.push_back(x);
+    }
+    while(ural::prev_permutation(x));
+
+    BOOST_CHECK(r_std == r_ural);
+}
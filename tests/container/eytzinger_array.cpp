@@ -0,0 +1,178 @@
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <ural/container/eytzinger_array.hpp>
+#include <ural/sequence/to.hpp>
+#include <ural/numeric/numbers_sequence.hpp>
+#include <ural/concepts.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace ural_ex = ural::experimental;
+
+BOOST_AUTO_TEST_CASE(eytzinger_array_default_template_parameters)
+{
+    typedef int T;
+    typedef ural_ex::eytzinger_array<T> Array;
+
+    static_assert(std::is_same<::ural::value_type_t<Array>, T>::value, "");
+    static_assert(std::is_same<Array::value_compare, std::less<T>>::value, "");
+    static_assert(std::is_same<Array::allocator_type, std::allocator<T>>::value, "");
+
+    BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE(eytzinger_array_layout_test)
+{
+    ural_ex::eytzinger_array<int> const xs = {1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> const expected = {4, 2, 6, 1, 3, 5, 7};
+
+    BOOST_CHECK_EQUAL(xs.size(), expected.size());
+    BOOST_CHECK(std::equal(xs.begin(), xs.end(), expected.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(eytzinger_array_search_test)
+{
+    for(auto n : {0, 1, 2, 3, 7, 8, 15, 16, 17, 100, 1000})
+    {
+        std::vector<int> sorted;
+        for(auto i = 0; i < n; ++ i)
+        {
+            sorted.push_back(2 * (i / 2));
+        }
+
+        auto const xs = sorted | ural_ex::to_container<ural_ex::eytzinger_array>{};
+
+        BOOST_CHECK_EQUAL(xs.size(), sorted.size());
+        BOOST_CHECK(std::is_permutation(xs.begin(), xs.end(), sorted.begin()));
+
+        for(auto x = -1; x <= n + 1; ++ x)
+        {
+            auto const lb = std::lower_bound(sorted.begin(), sorted.end(), x);
+            auto const ub = std::upper_bound(sorted.begin(), sorted.end(), x);
+
+            auto const r_lb = xs.lower_bound(x);
+            auto const r_ub = xs.upper_bound(x);
+
+            BOOST_CHECK_EQUAL(r_lb == xs.end(), lb == sorted.end());
+            BOOST_CHECK_EQUAL(r_ub == xs.end(), ub == sorted.end());
+
+            if(lb != sorted.end() && r_lb != xs.end())
+            {
+                BOOST_CHECK_EQUAL(*r_lb, *lb);
+            }
+
+            if(ub != sorted.end() && r_ub != xs.end())
+            {
+                BOOST_CHECK_EQUAL(*r_ub, *ub);
+            }
+
+            BOOST_CHECK_EQUAL(xs.contains(x),
+                              std::binary_search(sorted.begin(), sorted.end(), x));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(eytzinger_array_from_sequence_test)
+{
+    auto const xs = ural::numbers(0, 50)
+                  | ural_ex::to_container<ural_ex::eytzinger_array>{};
+
+    BOOST_CHECK_EQUAL(xs.size(), 50U);
+    BOOST_CHECK(xs.contains(0));
+    BOOST_CHECK(xs.contains(49));
+    BOOST_CHECK(!xs.contains(50));
+    BOOST_CHECK(xs.find(50) == xs.end());
+    BOOST_CHECK_EQUAL(*xs.find(17), 17);
+}
+
+BOOST_AUTO_TEST_CASE(eytzinger_array_custom_compare_test)
+{
+    std::vector<std::string> const sorted = {"z", "x", "m", "d", "b"};
+
+    ural_ex::eytzinger_array<std::string, std::greater<std::string>>
+        const xs(sorted.begin(), sorted.end());
+
+    BOOST_CHECK_EQUAL(*xs.lower_bound("n"), "m");
+    BOOST_CHECK_EQUAL(*xs.upper_bound("m"), "d");
+    BOOST_CHECK(xs.lower_bound("a") == xs.end());
+    BOOST_CHECK(xs.contains("x"));
+    BOOST_CHECK(!xs.contains("y"));
+}
+
+BOOST_AUTO_TEST_CASE(eytzinger_array_unsorted_input_test)
+{
+    std::vector<int> const src = {5, 3, 9, 1, 3, 7, 0, 8};
+
+    ural_ex::eytzinger_array<int> const xs(src.begin(), src.end());
+    ural_ex::eytzinger_array<int> const expected = {0, 1, 3, 3, 5, 7, 8, 9};
+
+    BOOST_CHECK(xs == expected);
+
+    for(auto x : src)
+    {
+        BOOST_CHECK(xs.contains(x));
+        BOOST_CHECK_EQUAL(*xs.lower_bound(x), x);
+    }
+
+    BOOST_CHECK(!xs.contains(2));
+    BOOST_CHECK_EQUAL(*xs.upper_bound(3), 5);
+}
+
+namespace
+{
+    // Тип без конструктора без параметров
+    struct Explicit_int
+    {
+        explicit Explicit_int(int x)
+         : value(x)
+        {}
+
+        friend bool operator<(Explicit_int const & x, Explicit_int const & y)
+        {
+            return x.value < y.value;
+        }
+
+        int value;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(eytzinger_array_not_default_constructible_test)
+{
+    std::vector<Explicit_int> src;
+    for(auto x : {4, 2, 6, 1, 3, 5, 7})
+    {
+        src.emplace_back(x);
+    }
+
+    ural_ex::eytzinger_array<Explicit_int> const xs(src.begin(), src.end());
+
+    std::vector<int> const expected = {4, 2, 6, 1, 3, 5, 7};
+
+    BOOST_CHECK_EQUAL(xs.size(), expected.size());
+
+    for(auto i = 0U; i != expected.size(); ++ i)
+    {
+        BOOST_CHECK_EQUAL(xs[i].value, expected[i]);
+    }
+
+    BOOST_CHECK_EQUAL(xs.lower_bound(Explicit_int(3))->value, 3);
+    BOOST_CHECK(!xs.contains(Explicit_int(8)));
+}
@@ -80,9 +80,11 @@ md5 contributions   llvm/lib/Support/MD5.cpp llvm/include/llvm/Support/MD5.h
 #include <ural/algorithm.hpp>
 #include <ural/statistics.hpp>
 #include <ural/random.hpp>
+#include <ural/random/uniform_index.hpp>
 #include <ural/math.hpp>
 
 #include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
 #include "../tests/defs.hpp"
 
 #include <boost/math/distributions/chi_squared.hpp>
@@ -826,3 +828,62 @@ BOOST_AUTO_TEST_CASE(iid_adaptor_equality_test)
     BOOST_CHECK(d1 != d2);
     BOOST_CHECK(d2 != d3);
 }
+
+namespace
+{
+    typedef boost::mpl::list<std::mt19937, std::mt19937_64, std::minstd_rand,
+                             ural::experimental::c_rand_engine> Index_engines;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(uniform_index_generator_test, G, Index_engines)
+{
+    G g;
+    auto index = ural_ex::make_uniform_index_generator(g);
+
+    for(auto n : {1, 2, 3, 7, 10, 1000})
+    {
+        std::vector<std::size_t> counts(n, 0);
+
+        auto const per_value = 1000;
+        auto const total = n * per_value;
+
+        for(auto i = 0; i < total; ++ i)
+        {
+            auto const k = index(n);
+
+            BOOST_CHECK_LT(k, std::uint64_t(n));
+
+            if(k < std::uint64_t(n))
+            {
+                ++ counts[k];
+            }
+        }
+
+        double chi_square = 0;
+
+        for(auto const & c : counts)
+        {
+            chi_square += ural::square(double(c) - per_value) / per_value;
+        }
+
+        if(n > 1)
+        {
+            boost::math::chi_squared_distribution<double> const d{double(n - 1)};
+
+            BOOST_CHECK_LT(chi_square, quantile(d, 0.9999));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(uniform_index_generator_large_bound_test)
+{
+    std::mt19937_64 g;
+    auto index = ural_ex::make_uniform_index_generator(g);
+
+    auto const n = std::uint64_t(1) << 40;
+
+    for(auto i = 0; i < 1000; ++ i)
+    {
+        BOOST_CHECK_LT(index(n), n);
+    }
+}
@@ -0,0 +1,196 @@
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <ural/sequence/adaptors/aho_corasick.hpp>
+#include <ural/sequence/by_line.hpp>
+#include <ural/sequence/iostream.hpp>
+#include <ural/algorithm.hpp>
+
+#include <boost/test/unit_test.hpp>
+#include "../../defs.hpp"
+#include "../../rnd.hpp"
+
+#include <set>
+#include <sstream>
+
+namespace
+{
+    namespace ural_ex = ::ural::experimental;
+
+    typedef ural::tuple<std::size_t, std::size_t> Match;
+
+    template <class Cursor>
+    std::vector<Match> collect(Cursor s)
+    {
+        std::vector<Match> result;
+
+        for(; !!s; ++ s)
+        {
+            result.push_back(*s);
+        }
+
+        return result;
+    }
+
+    std::set<Match>
+    naive_matches(std::string const & text,
+                  std::vector<std::string> const & patterns)
+    {
+        std::set<Match> result;
+
+        for(std::size_t id = 0; id != patterns.size(); ++ id)
+        {
+            auto const & p = patterns[id];
+
+            if(p.empty() || ural::find(patterns, p).begin() != patterns.begin() + id)
+            {
+                continue;
+            }
+
+            for(auto pos = text.find(p); pos != std::string::npos; pos = text.find(p, pos + 1))
+            {
+                result.insert(Match(pos, id));
+            }
+        }
+
+        return result;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(aho_corasick_cursor_test)
+{
+    ural_ex::aho_corasick_automaton const ac{"he", "she", "his", "hers"};
+
+    BOOST_CHECK_EQUAL(4U, ac.size());
+    BOOST_CHECK_EQUAL(4U, ac.pattern_size(3));
+
+    std::string const text = "ushers";
+
+    auto const r = collect(text | ural_ex::aho_corasick_matches(ac));
+
+    std::vector<Match> const expected{Match(1, 1), Match(2, 0), Match(2, 3)};
+
+    BOOST_CHECK_EQUAL(expected.size(), r.size());
+    BOOST_CHECK(std::set<Match>(r.begin(), r.end())
+                == std::set<Match>(expected.begin(), expected.end()));
+}
+
+BOOST_AUTO_TEST_CASE(aho_corasick_cursor_empty)
+{
+    ural_ex::aho_corasick_automaton const ac{"", "abc"};
+
+    auto const s1 = ural_ex::make_aho_corasick_cursor(std::string(), ac);
+    BOOST_CHECK(!s1);
+
+    auto const s2 = ural_ex::make_aho_corasick_cursor(std::string("xyzab"), ac);
+    BOOST_CHECK(!s2);
+
+    std::vector<std::string> const none;
+    ural_ex::aho_corasick_automaton const empty(none);
+
+    BOOST_CHECK(!ural_ex::make_aho_corasick_cursor(std::string("abc"), empty));
+}
+
+BOOST_AUTO_TEST_CASE(aho_corasick_automaton_copy_test)
+{
+    std::vector<std::string> const patterns{"he", "she", "his", "hers"};
+
+    ural_ex::aho_corasick_automaton ac(patterns);
+
+    // Копирование неконстантного объекта не должно приниматься за
+    // построение по последовательности образцов
+    ural_ex::aho_corasick_automaton copy(ac);
+    ural_ex::aho_corasick_automaton moved(std::move(ac));
+
+    BOOST_CHECK_EQUAL(patterns.size(), copy.size());
+    BOOST_CHECK_EQUAL(patterns.size(), moved.size());
+
+    std::string const text = "ushers";
+
+    auto const r_copy = collect(text | ural_ex::aho_corasick_matches(copy));
+    auto const r_moved = collect(ural_ex::make_aho_corasick_cursor(text, moved));
+
+    BOOST_CHECK(std::set<Match>(r_copy.begin(), r_copy.end())
+                == naive_matches(text, patterns));
+    BOOST_CHECK(r_copy == r_moved);
+}
+
+BOOST_AUTO_TEST_CASE(aho_corasick_cursor_random)
+{
+    std::uniform_int_distribution<int> letter('a', 'c');
+    std::uniform_int_distribution<int> length(0, 5);
+
+    auto & rnd = ural_test::random_engine();
+
+    for(auto k = 0; k < 20; ++ k)
+    {
+        std::vector<std::string> patterns(30);
+
+        for(auto & p : patterns)
+        {
+            p.resize(length(rnd));
+
+            for(auto & c : p)
+            {
+                c = static_cast<char>(letter(rnd));
+            }
+        }
+
+        std::string text(500, 'a');
+
+        for(auto & c : text)
+        {
+            c = static_cast<char>(letter(rnd));
+        }
+
+        ural_ex::aho_corasick_automaton const ac(patterns);
+
+        auto const r = collect(ural_ex::make_aho_corasick_cursor(text, ac));
+
+        std::set<Match> const r_set(r.begin(), r.end());
+
+        BOOST_CHECK_EQUAL(r.size(), r_set.size());
+        BOOST_CHECK(r_set == naive_matches(text, patterns));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(aho_corasick_cursor_by_line)
+{
+    ural_ex::aho_corasick_automaton const ac{"error", "warn", "or\nwa"};
+
+    std::istringstream is("an error\nwarning: errors\nno\n");
+
+    auto const r = collect(ural_ex::by_line(is) | ural_ex::aho_corasick_matches(ac));
+
+    // Символы перевода строки в позициях не учитываются
+    std::vector<Match> const expected{Match(3, 0), Match(8, 1), Match(17, 0)};
+
+    BOOST_CHECK(r == expected);
+}
+
+BOOST_AUTO_TEST_CASE(aho_corasick_cursor_istream)
+{
+    ural_ex::aho_corasick_automaton const ac{"ab", "b"};
+
+    std::istringstream is("a b a a b");
+
+    auto const r = collect(ural_ex::make_istream_cursor<char>(is)
+                           | ural_ex::aho_corasick_matches(ac));
+
+    std::vector<Match> const expected{Match(0, 0), Match(1, 1), Match(3, 0), Match(4, 1)};
+
+    BOOST_CHECK(r == expected);
+}
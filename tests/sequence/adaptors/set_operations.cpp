@@ -18,6 +18,7 @@
 #include <ural/sequence/all.hpp>
 
 #include <forward_list>
+#include <list>
 
 #include <boost/mpl/list.hpp>
 #include <boost/test/unit_test.hpp>
@@ -134,3 +135,121 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(set_operations_traversed_front, Maker, SetOperatio
     auto rs2 = s2.traversed_front();
     BOOST_CHECK(rs1 == rs2);
 }
+
+BOOST_AUTO_TEST_CASE(k_merge_cursor_test)
+{
+    for(auto k : {0, 1, 2, 3, 5, 8, 13})
+    {
+        std::vector<std::vector<int>> runs(k);
+
+        for(auto i = 0; i < 10 * k; ++ i)
+        {
+            runs[(i * 7) % k].push_back(i / 3);
+        }
+
+        std::vector<int> expected;
+        for(auto const & run : runs)
+        {
+            BOOST_CHECK(std::is_sorted(run.begin(), run.end()));
+            expected.insert(expected.end(), run.begin(), run.end());
+        }
+        std::sort(expected.begin(), expected.end());
+
+        auto const r_ural = ural_ex::k_merged(runs)
+                          | ural_ex::to_container<std::vector>{};
+
+        URAL_CHECK_EQUAL_RANGES(expected, r_ural);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(k_merge_cursor_empty_runs_test)
+{
+    std::vector<std::vector<int>> const runs = {{}, {1, 4}, {}, {2, 3, 5}, {}};
+    std::vector<int> const expected = {1, 2, 3, 4, 5};
+
+    auto const r_ural = ural_ex::k_merged(runs)
+                      | ural_ex::to_container<std::vector>{};
+
+    URAL_CHECK_EQUAL_RANGES(expected, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(k_merge_cursor_is_stable_test)
+{
+    typedef std::pair<int, int> Pair;
+
+    std::vector<std::vector<Pair>> runs(4);
+    for(auto i = 0; i < 40; ++ i)
+    {
+        runs[i % 4].emplace_back(i / 8, i % 4);
+    }
+
+    auto cmp = [](Pair const & x, Pair const & y) { return x.first < y.first; };
+
+    std::vector<Pair> expected;
+    for(auto const & run : runs)
+    {
+        expected.insert(expected.end(), run.begin(), run.end());
+    }
+    std::stable_sort(expected.begin(), expected.end(), cmp);
+
+    auto const r_ural = ural_ex::k_merged(runs, cmp)
+                      | ural_ex::to_container<std::vector>{};
+
+    BOOST_CHECK(expected == r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(k_merge_cursor_greater_test)
+{
+    std::vector<std::vector<int>> const runs = {{9, 5, 1}, {8, 5, 2}, {7}};
+    std::vector<int> const expected = {9, 8, 7, 5, 5, 2, 1};
+
+    auto const r_ural = ural_ex::k_merged(runs, ural::greater<>{})
+                      | ural_ex::to_container<std::vector>{};
+
+    URAL_CHECK_EQUAL_RANGES(expected, r_ural);
+}
+
+BOOST_AUTO_TEST_CASE(set_intersection_difference_cursor_skewed_test)
+{
+    std::vector<int> large;
+    for(auto i = 0; i < 10000; ++ i)
+    {
+        large.push_back(i / 2);
+    }
+
+    for(auto step : {1, 3, 17, 250, 4999, 6000})
+    {
+        std::vector<int> small;
+        for(auto i = -2; i < 5100; i += step)
+        {
+            small.push_back(i);
+            small.push_back(i);
+        }
+
+        std::list<int> const small_list(small.begin(), small.end());
+
+        std::vector<int> r_std;
+        std::set_intersection(small.begin(), small.end(), large.begin(), large.end(),
+                              std::back_inserter(r_std));
+
+        auto const r_1 = ural_ex::make_set_intersection_cursor(small, large)
+                       | ural_ex::to_container<std::vector>{};
+        auto const r_2 = ural_ex::make_set_intersection_cursor(large, small)
+                       | ural_ex::to_container<std::vector>{};
+        auto const r_3 = ural_ex::make_set_intersection_cursor(small_list, large)
+                       | ural_ex::to_container<std::vector>{};
+
+        URAL_CHECK_EQUAL_RANGES(r_std, r_1);
+        URAL_CHECK_EQUAL_RANGES(r_std, r_2);
+        URAL_CHECK_EQUAL_RANGES(r_std, r_3);
+
+        std::vector<int> d_std;
+        std::set_difference(small.begin(), small.end(), large.begin(), large.end(),
+                            std::back_inserter(d_std));
+
+        auto const d_ural = ural_ex::make_set_difference_cursor(small, large)
+                          | ural_ex::to_container<std::vector>{};
+
+        URAL_CHECK_EQUAL_RANGES(d_std, d_ural);
+    }
+}
@@ -395,6 +395,7 @@ namespace
 
     // 25.3.12 Тасовка
     constexpr auto const & shuffle = odr_const<shuffle_fn>;
+    constexpr auto const & sample = odr_const<sample_fn>;
 
     // 25.3.13 Разделение
     constexpr auto const & is_partitioned = odr_const<is_partitioned_fn>;
@@ -409,6 +410,8 @@ namespace
 
     // 25.4.1.1 Быстрая сортировка
     constexpr auto const & sort = odr_const<sort_fn>;
+    constexpr auto const & pdq_sort = odr_const<pdq_sort_fn>;
+    constexpr auto const & radix_sort = odr_const<radix_sort_fn>;
 
     // 25.4.1.2 Устойчивая сортировка
     constexpr auto const & stable_sort = odr_const<stable_sort_fn>;
@@ -429,11 +432,13 @@ namespace
     // 25.4.3 Бинарный поиск
     constexpr auto const & lower_bound = odr_const<lower_bound_fn>;
     constexpr auto const & upper_bound = odr_const<upper_bound_fn>;
+    constexpr auto const & lower_bound_many = odr_const<lower_bound_many_fn>;
     constexpr auto const & equal_range = odr_const<equal_range_fn>;
     constexpr auto const & binary_search = odr_const<binary_search_fn>;
 
     // 25.4.4 Слияние
     constexpr auto const & merge = odr_const_holder<merge_fn>::value;
+    constexpr auto const & k_merge = odr_const<k_merge_fn>;
     constexpr auto const & inplace_merge = odr_const_holder<inplace_merge_fn>::value;
 
     // 25.4.5 Операции с сортированными множествами
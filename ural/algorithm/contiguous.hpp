@@ -0,0 +1,1380 @@
+#ifndef Z_URAL_ALGORITHM_CONTIGUOUS_HPP_INCLUDED
+#define Z_URAL_ALGORITHM_CONTIGUOUS_HPP_INCLUDED
+
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/** @file ural/algorithm/contiguous.hpp
+ @brief Распознавание курсоров, ссылающихся на непрерывный участок памяти, и
+ векторизованные реализации базовых алгоритмов для таких курсоров.
+ @note Этот файл предназначен для разработчиков библиотеки, не включайте его
+ в свой код, только если это действительно необходимо.
+*/
+
+#include <ural/sequence/iterator_cursor.hpp>
+#include <ural/functional/cpp_operators.hpp>
+#include <ural/concepts.hpp>
+#include <ural/tuple.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ural
+{
+inline namespace v1
+{
+    /// @cond false
+    namespace details
+    {
+        template <class T>
+        struct is_byte_like
+         : std::integral_constant<bool, std::is_integral<T>::value
+                                        && !std::is_same<T, bool>::value
+                                        && sizeof(T) == 1>
+        {};
+
+        // Целые числа, равенство которых совпадает с равенством их битов
+        template <class T>
+        struct is_bitwise_comparable
+         : std::integral_constant<bool, std::is_integral<T>::value
+                                        && !std::is_same<T, bool>::value
+                                        && (sizeof(T) == 1 || sizeof(T) == 2
+                                            || sizeof(T) == 4 || sizeof(T) == 8)>
+        {};
+
+        template <class T>
+        struct is_string_char
+         : std::integral_constant<bool, std::is_same<T, char>::value
+                                        || std::is_same<T, wchar_t>::value
+                                        || std::is_same<T, char16_t>::value
+                                        || std::is_same<T, char32_t>::value>
+        {};
+
+        // Итераторы стандартных контейнеров, хранящих элементы в массиве
+        template <class Iterator, class Value,
+                  bool = std::is_trivially_copyable<Value>::value
+                         && !std::is_same<Value, bool>::value>
+        struct is_contiguous_library_iterator
+         : std::integral_constant<bool, std::is_same<Iterator, typename std::vector<Value>::iterator>::value
+                                        || std::is_same<Iterator, typename std::vector<Value>::const_iterator>::value>
+        {};
+
+        template <class Iterator, class Value>
+        struct is_contiguous_library_iterator<Iterator, Value, false>
+         : std::false_type
+        {};
+
+        template <class Iterator, class Value, bool = is_string_char<Value>::value>
+        struct is_contiguous_string_iterator
+         : std::integral_constant<bool, std::is_same<Iterator, typename std::basic_string<Value>::iterator>::value
+                                        || std::is_same<Iterator, typename std::basic_string<Value>::const_iterator>::value>
+        {};
+
+        template <class Iterator, class Value>
+        struct is_contiguous_string_iterator<Iterator, Value, false>
+         : std::false_type
+        {};
+
+        template <class Iterator>
+        struct is_contiguous_iterator
+         : std::integral_constant<bool, is_contiguous_library_iterator<Iterator, value_type_t<std::iterator_traits<Iterator>>>::value
+                                        || is_contiguous_string_iterator<Iterator, value_type_t<std::iterator_traits<Iterator>>>::value>
+        {};
+
+        template <class T>
+        struct is_contiguous_iterator<T *>
+         : std::true_type
+        {};
+
+        template <class Cursor>
+        struct is_contiguous_cursor
+         : std::false_type
+        {};
+
+        template <class Iterator, class Policy>
+        struct is_contiguous_cursor<iterator_cursor<Iterator, Policy>>
+         : is_contiguous_iterator<Iterator>
+        {};
+
+        /* Поиск значения типа T в курсоре можно свести к сравнению битов,
+        если курсор ссылается на массив целых чисел, а сравнение выполняется
+        оператором "равно".
+        */
+        template <class Cursor, class T, class BinaryPredicate>
+        struct use_contiguous_find
+         : std::integral_constant<bool, is_contiguous_cursor<Cursor>::value
+                                        && is_bitwise_comparable<value_type_t<Cursor>>::value
+                                        && std::is_integral<T>::value
+                                        && std::is_same<BinaryPredicate, ::ural::equal_to<>>::value>
+        {};
+
+        /* Последовательности целых чисел одного типа равны тогда и только
+        тогда, когда совпадают их представления в памяти.
+        */
+        template <class Cursor1, class Cursor2>
+        struct is_contiguous_same_integers
+         : std::integral_constant<bool, is_contiguous_cursor<Cursor1>::value
+                                        && is_contiguous_cursor<Cursor2>::value
+                                        && is_bitwise_comparable<value_type_t<Cursor1>>::value
+                                        && std::is_same<value_type_t<Cursor1>, value_type_t<Cursor2>>::value>
+        {};
+
+        template <class Cursor1, class Cursor2, class BinaryPredicate>
+        struct use_contiguous_mismatch
+         : std::integral_constant<bool, is_contiguous_same_integers<Cursor1, Cursor2>::value
+                                        && std::is_same<BinaryPredicate, ::ural::equal_to<>>::value>
+        {};
+
+        template <class Cursor1, class Cursor2, class Compare>
+        struct use_contiguous_lexicographical_compare
+         : std::integral_constant<bool, is_contiguous_same_integers<Cursor1, Cursor2>::value
+                                        && std::is_same<Compare, ::ural::less<>>::value>
+        {};
+
+        // Числа, порядок которых задаётся встроенным оператором "меньше"
+        template <class T>
+        struct is_simd_ordered
+         : std::integral_constant<bool, is_bitwise_comparable<T>::value
+                                        || std::is_same<T, float>::value
+                                        || std::is_same<T, double>::value>
+        {};
+
+        // Упорядочение чисел в массиве встроенным оператором "меньше"
+        template <class Cursor, class Compare>
+        struct use_contiguous_ordering
+         : std::integral_constant<bool, is_contiguous_cursor<Cursor>::value
+                                        && is_simd_ordered<value_type_t<Cursor>>::value
+                                        && std::is_same<Compare, ::ural::less<>>::value>
+        {};
+
+        template <class Cursor, class BinaryPredicate>
+        struct use_contiguous_adjacent_find
+         : std::integral_constant<bool, is_contiguous_cursor<Cursor>::value
+                                        && is_simd_ordered<value_type_t<Cursor>>::value
+                                        && std::is_same<BinaryPredicate, ::ural::equal_to<>>::value>
+        {};
+
+        /* Запись в элементы массива через ссылку на неконстантный объект.
+        У курсоров вывода может не быть типа значения, поэтому остальные
+        условия проверяются только для курсоров, ссылающихся на массив.
+        */
+        template <class Cursor, bool = is_contiguous_cursor<Cursor>::value>
+        struct is_contiguous_writable
+         : std::is_same<reference_type_t<Cursor>, value_type_t<Cursor> &>
+        {};
+
+        template <class Cursor>
+        struct is_contiguous_writable<Cursor, false>
+         : std::false_type
+        {};
+
+        /* Копирование (и перемещение) тривиально копируемых объектов можно
+        выполнить одним вызовом memmove.
+        */
+        template <class Input, class Output,
+                  bool = is_contiguous_cursor<Input>::value
+                         && is_contiguous_writable<Output>::value>
+        struct use_contiguous_copy
+         : std::integral_constant<bool, std::is_trivially_copyable<value_type_t<Input>>::value
+                                        && std::is_same<value_type_t<Input>, value_type_t<Output>>::value>
+        {};
+
+        template <class Input, class Output>
+        struct use_contiguous_copy<Input, Output, false>
+         : std::false_type
+        {};
+
+        /* Элементы арифметических типов и указатели при отборе по предикату
+        можно записывать безусловно, а затем сдвигать позицию записи на
+        значение предиката.
+        */
+        template <class Input, class Output,
+                  bool = use_contiguous_copy<Input, Output>::value>
+        struct use_contiguous_filter
+         : std::is_scalar<value_type_t<Input>>
+        {};
+
+        template <class Input, class Output>
+        struct use_contiguous_filter<Input, Output, false>
+         : std::false_type
+        {};
+
+        // Числа и указатели, в представлении которых нет битов заполнения
+        template <class T>
+        struct is_memset_fillable
+         : std::integral_constant<bool, std::is_integral<T>::value
+                                        || std::is_enum<T>::value
+                                        || std::is_pointer<T>::value
+                                        || std::is_same<T, float>::value
+                                        || std::is_same<T, double>::value>
+        {};
+
+        template <class Cursor, class T,
+                  bool = is_contiguous_writable<Cursor>::value>
+        struct use_contiguous_fill
+         : std::integral_constant<bool, is_memset_fillable<value_type_t<Cursor>>::value
+                                        && std::is_convertible<T const &, value_type_t<Cursor>>::value>
+        {};
+
+        template <class Cursor, class T>
+        struct use_contiguous_fill<Cursor, T, false>
+         : std::false_type
+        {};
+
+        /* Приведение value к типу элементов. Если результат не равен value,
+        то ни один элемент не равен value.
+        */
+        template <class T, class U>
+        bool narrow_value(U const & value, T & result)
+        {
+            static_assert(std::is_integral<T>::value && std::is_integral<U>::value, "");
+
+            result = static_cast<T>(value);
+
+            // Сравнение в общем типе, как у оператора == без приведений, но
+            // без предупреждений о сравнении знаковых и беззнаковых чисел
+            using Common = typename std::common_type<T, U>::type;
+
+            return static_cast<Common>(result) == static_cast<Common>(value);
+        }
+
+        template <class Cursor>
+        auto contiguous_data(Cursor const & cur)
+        -> typename std::remove_reference<reference_type_t<Cursor>>::type *
+        {
+            if(!cur)
+            {
+                return nullptr;
+            }
+
+            return std::addressof(*cur.begin());
+        }
+
+        template <std::size_t N>
+        struct unsigned_of_size;
+
+        template <>
+        struct unsigned_of_size<1>
+        {
+            typedef std::uint8_t type;
+        };
+
+        template <>
+        struct unsigned_of_size<2>
+        {
+            typedef std::uint16_t type;
+        };
+
+        template <>
+        struct unsigned_of_size<4>
+        {
+            typedef std::uint32_t type;
+        };
+
+        template <>
+        struct unsigned_of_size<8>
+        {
+            typedef std::uint64_t type;
+        };
+
+        template <std::size_t N>
+        using element_size_tag = std::integral_constant<std::size_t, N>;
+
+    #if defined(__GNUC__) && defined(__AVX2__)
+        struct simd_ops
+        {
+            typedef __m256i reg;
+
+            static constexpr std::size_t width = 32;
+
+            static reg load(void const * p)
+            {
+                return _mm256_loadu_si256(static_cast<reg const *>(p));
+            }
+
+            static reg broadcast(std::uint8_t x)
+            {
+                return _mm256_set1_epi8(static_cast<char>(x));
+            }
+
+            static reg broadcast(std::uint16_t x)
+            {
+                return _mm256_set1_epi16(static_cast<short>(x));
+            }
+
+            static reg broadcast(std::uint32_t x)
+            {
+                return _mm256_set1_epi32(static_cast<int>(x));
+            }
+
+            static reg broadcast(std::uint64_t x)
+            {
+                return _mm256_set1_epi64x(static_cast<long long>(x));
+            }
+
+            static reg equal(reg x, reg y, element_size_tag<1>)
+            {
+                return _mm256_cmpeq_epi8(x, y);
+            }
+
+            static reg equal(reg x, reg y, element_size_tag<2>)
+            {
+                return _mm256_cmpeq_epi16(x, y);
+            }
+
+            static reg equal(reg x, reg y, element_size_tag<4>)
+            {
+                return _mm256_cmpeq_epi32(x, y);
+            }
+
+            static reg equal(reg x, reg y, element_size_tag<8>)
+            {
+                return _mm256_cmpeq_epi64(x, y);
+            }
+
+            static reg bit_or(reg x, reg y)
+            {
+                return _mm256_or_si256(x, y);
+            }
+
+            static reg zero()
+            {
+                return _mm256_setzero_si256();
+            }
+
+            static void store(void * p, reg x)
+            {
+                _mm256_storeu_si256(static_cast<reg *>(p), x);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<1>)
+            {
+                return _mm256_sub_epi8(x, y);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<2>)
+            {
+                return _mm256_sub_epi16(x, y);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<4>)
+            {
+                return _mm256_sub_epi32(x, y);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<8>)
+            {
+                return _mm256_sub_epi64(x, y);
+            }
+
+            static unsigned mask(reg x)
+            {
+                return static_cast<unsigned>(_mm256_movemask_epi8(x));
+            }
+        };
+    #elif defined(__GNUC__) && defined(__SSE2__)
+        struct simd_ops
+        {
+            typedef __m128i reg;
+
+            static constexpr std::size_t width = 16;
+
+            static reg load(void const * p)
+            {
+                return _mm_loadu_si128(static_cast<reg const *>(p));
+            }
+
+            static reg broadcast(std::uint8_t x)
+            {
+                return _mm_set1_epi8(static_cast<char>(x));
+            }
+
+            static reg broadcast(std::uint16_t x)
+            {
+                return _mm_set1_epi16(static_cast<short>(x));
+            }
+
+            static reg broadcast(std::uint32_t x)
+            {
+                return _mm_set1_epi32(static_cast<int>(x));
+            }
+
+            static reg broadcast(std::uint64_t x)
+            {
+                return _mm_set1_epi64x(static_cast<long long>(x));
+            }
+
+            static reg equal(reg x, reg y, element_size_tag<1>)
+            {
+                return _mm_cmpeq_epi8(x, y);
+            }
+
+            static reg equal(reg x, reg y, element_size_tag<2>)
+            {
+                return _mm_cmpeq_epi16(x, y);
+            }
+
+            static reg equal(reg x, reg y, element_size_tag<4>)
+            {
+                return _mm_cmpeq_epi32(x, y);
+            }
+
+            // В SSE2 нет сравнения 64-битных чисел: обе половины должны совпасть
+            static reg equal(reg x, reg y, element_size_tag<8>)
+            {
+                auto const r = _mm_cmpeq_epi32(x, y);
+                return _mm_and_si128(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+
+            static reg bit_or(reg x, reg y)
+            {
+                return _mm_or_si128(x, y);
+            }
+
+            static reg zero()
+            {
+                return _mm_setzero_si128();
+            }
+
+            static void store(void * p, reg x)
+            {
+                _mm_storeu_si128(static_cast<reg *>(p), x);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<1>)
+            {
+                return _mm_sub_epi8(x, y);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<2>)
+            {
+                return _mm_sub_epi16(x, y);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<4>)
+            {
+                return _mm_sub_epi32(x, y);
+            }
+
+            static reg subtract(reg x, reg y, element_size_tag<8>)
+            {
+                return _mm_sub_epi64(x, y);
+            }
+
+            static unsigned mask(reg x)
+            {
+                return static_cast<unsigned>(_mm_movemask_epi8(x));
+            }
+        };
+    #endif
+
+    #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+        /* Векторы встроенных арифметических типов размером с регистр simd_ops.
+        Операции над ними компилятор сам переводит в команды для заданного
+        набора инструкций, а результат сравнения можно передать в
+        simd_ops::mask.
+        */
+        template <class T>
+        struct simd_vector
+        {
+            typedef T type __attribute__((vector_size(simd_ops::width)));
+
+            static constexpr std::ptrdiff_t size = simd_ops::width / sizeof(T);
+
+            static type load(T const * p)
+            {
+                type x;
+                std::memcpy(&x, p, sizeof(x));
+                return x;
+            }
+
+            static type broadcast(T const & value)
+            {
+                type x;
+                for(std::ptrdiff_t k = 0; k != size; ++ k)
+                {
+                    x[k] = value;
+                }
+                return x;
+            }
+
+            template <class Mask>
+            static unsigned mask(Mask const & m)
+            {
+                return simd_ops::mask((typename simd_ops::reg)(m));
+            }
+        };
+    #endif
+
+        /* Каждый совпавший элемент даёт sizeof(T) единичных битов в маске,
+        поэтому индекс первого совпадения --- это номер младшего единичного
+        бита, делённый на sizeof(T).
+        */
+        template <class T>
+        T const * find_value(T const * first, T const * last, T const & value)
+        {
+            static_assert(is_bitwise_comparable<T>::value, "");
+
+            if(first == last)
+            {
+                return last;
+            }
+
+            if(sizeof(T) == 1)
+            {
+                auto const r = std::memchr(first, static_cast<unsigned char>(value),
+                                           static_cast<std::size_t>(last - first));
+
+                return r ? static_cast<T const *>(r) : last;
+            }
+
+        #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+            typedef typename unsigned_of_size<sizeof(T)>::type Unsigned;
+
+            constexpr auto step = static_cast<std::ptrdiff_t>(simd_ops::width / sizeof(T));
+
+            auto const needle = simd_ops::broadcast(static_cast<Unsigned>(value));
+
+            for(; last - first >= step; first += step)
+            {
+                auto const m = simd_ops::mask(simd_ops::equal(simd_ops::load(first), needle,
+                                                              element_size_tag<sizeof(T)>{}));
+
+                if(m != 0)
+                {
+                    return first + __builtin_ctz(m) / sizeof(T);
+                }
+            }
+        #endif
+
+            for(; first != last; ++ first)
+            {
+                if(*first == value)
+                {
+                    return first;
+                }
+            }
+
+            return last;
+        }
+
+        /* Совпавшие элементы дают в результате сравнения -1, поэтому
+        вычитание результатов сравнения считает совпадения в каждой позиции
+        регистра. Счётчики переносятся в результат до того, как могут
+        переполниться.
+        */
+        template <class T>
+        std::ptrdiff_t count_value(T const * first, T const * last, T const & value)
+        {
+            static_assert(is_bitwise_comparable<T>::value, "");
+
+            std::ptrdiff_t result = 0;
+
+        #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+            typedef typename unsigned_of_size<sizeof(T)>::type Unsigned;
+
+            constexpr auto lanes = simd_ops::width / sizeof(T);
+            constexpr auto step = static_cast<std::ptrdiff_t>(lanes);
+            constexpr auto tag = element_size_tag<sizeof(T)>{};
+            constexpr auto max_block
+                = static_cast<std::ptrdiff_t>(std::min<std::uintmax_t>(std::numeric_limits<Unsigned>::max(),
+                                                                       std::uintmax_t(1) << 24));
+
+            auto const needle = simd_ops::broadcast(static_cast<Unsigned>(value));
+
+            while(last - first >= step)
+            {
+                auto const block = std::min((last - first) / step, max_block);
+                auto const block_end = first + block * step;
+
+                auto counters = simd_ops::zero();
+
+                for(; first != block_end; first += step)
+                {
+                    auto const eq = simd_ops::equal(simd_ops::load(first), needle, tag);
+                    counters = simd_ops::subtract(counters, eq, tag);
+                }
+
+                Unsigned buffer[lanes];
+                simd_ops::store(buffer, counters);
+
+                for(auto const & c : buffer)
+                {
+                    result += static_cast<std::ptrdiff_t>(c);
+                }
+            }
+        #endif
+
+            for(; first != last; ++ first)
+            {
+                if(*first == value)
+                {
+                    ++ result;
+                }
+            }
+
+            return result;
+        }
+
+        /// @brief Наибольшее количество значений, ищемых одновременно
+        constexpr std::size_t find_any_max_values = 4;
+
+        /* Поиск первого элемента, равного одному из values. Неиспользуемые
+        позиции массива values заполняются копиями values[0].
+        */
+        template <class T>
+        T const * find_any_value(T const * first, T const * last,
+                                 T const (&values)[find_any_max_values])
+        {
+            static_assert(is_bitwise_comparable<T>::value, "");
+
+        #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+            typedef typename unsigned_of_size<sizeof(T)>::type Unsigned;
+
+            constexpr auto step = static_cast<std::ptrdiff_t>(simd_ops::width / sizeof(T));
+            constexpr auto tag = element_size_tag<sizeof(T)>{};
+
+            auto const n0 = simd_ops::broadcast(static_cast<Unsigned>(values[0]));
+            auto const n1 = simd_ops::broadcast(static_cast<Unsigned>(values[1]));
+            auto const n2 = simd_ops::broadcast(static_cast<Unsigned>(values[2]));
+            auto const n3 = simd_ops::broadcast(static_cast<Unsigned>(values[3]));
+
+            for(; last - first >= step; first += step)
+            {
+                auto const x = simd_ops::load(first);
+
+                auto const r = simd_ops::bit_or(simd_ops::bit_or(simd_ops::equal(x, n0, tag),
+                                                                 simd_ops::equal(x, n1, tag)),
+                                                simd_ops::bit_or(simd_ops::equal(x, n2, tag),
+                                                                 simd_ops::equal(x, n3, tag)));
+                auto const m = simd_ops::mask(r);
+
+                if(m != 0)
+                {
+                    return first + __builtin_ctz(m) / sizeof(T);
+                }
+            }
+        #endif
+
+            for(; first != last; ++ first)
+            {
+                auto const & x = *first;
+
+                if(x == values[0] || x == values[1] || x == values[2] || x == values[3])
+                {
+                    return first;
+                }
+            }
+
+            return last;
+        }
+
+        /* Смещение первого несовпадающего байта или n, если все n байтов
+        совпадают.
+        */
+        inline std::size_t
+        mismatch_bytes(unsigned char const * x, unsigned char const * y,
+                       std::size_t n)
+        {
+            std::size_t i = 0;
+
+        #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+            constexpr auto step = simd_ops::width;
+            constexpr auto all_equal = static_cast<unsigned>((std::uint64_t(1) << step) - 1);
+
+            for(; n - i >= step; i += step)
+            {
+                auto const eq = simd_ops::equal(simd_ops::load(x + i),
+                                                simd_ops::load(y + i),
+                                                element_size_tag<1>{});
+                auto const m = simd_ops::mask(eq) ^ all_equal;
+
+                if(m != 0)
+                {
+                    return i + __builtin_ctz(m);
+                }
+            }
+        #endif
+
+            for(; i != n; ++ i)
+            {
+                if(x[i] != y[i])
+                {
+                    return i;
+                }
+            }
+
+            return n;
+        }
+
+        template <class T>
+        std::size_t mismatch_index(T const * x, T const * y, std::size_t n)
+        {
+            static_assert(is_bitwise_comparable<T>::value, "");
+
+            if(n == 0)
+            {
+                return 0;
+            }
+
+            auto const bytes
+                = details::mismatch_bytes(reinterpret_cast<unsigned char const *>(x),
+                                          reinterpret_cast<unsigned char const *>(y),
+                                          n * sizeof(T));
+
+            return bytes / sizeof(T);
+        }
+
+        /* Наименьшее и наибольшее значения массива. Все позиции регистров
+        заполняются первым элементом, а обновляются только при строгом
+        неравенстве, поэтому значения NaN, как и в последовательном алгоритме,
+        никогда не попадают в результат.
+        */
+        template <bool NeedMin, bool NeedMax, class T>
+        void min_max_values(T const * first, T const * last, T & lo, T & hi)
+        {
+            static_assert(is_simd_ordered<T>::value, "");
+            assert(first != last && *first == *first);
+
+            lo = *first;
+            hi = *first;
+
+        #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+            typedef simd_vector<T> Vector;
+
+            constexpr auto step = Vector::size;
+
+            if(last - first >= step)
+            {
+                auto v_lo = Vector::broadcast(lo);
+                auto v_hi = v_lo;
+
+                for(; last - first >= step; first += step)
+                {
+                    auto const x = Vector::load(first);
+
+                    if(NeedMin)
+                    {
+                        v_lo = x < v_lo ? x : v_lo;
+                    }
+                    if(NeedMax)
+                    {
+                        v_hi = v_hi < x ? x : v_hi;
+                    }
+                }
+
+                for(std::ptrdiff_t k = 0; k != step; ++ k)
+                {
+                    lo = v_lo[k] < lo ? v_lo[k] : lo;
+                    hi = hi < v_hi[k] ? v_hi[k] : hi;
+                }
+            }
+        #endif
+
+            for(; first != last; ++ first)
+            {
+                lo = *first < lo ? *first : lo;
+                hi = hi < *first ? *first : hi;
+            }
+        }
+
+        template <class T>
+        T const * find_equivalent(T const * first, T const * last, T const & value,
+                                  std::true_type)
+        {
+            return details::find_value(first, last, value);
+        }
+
+        /* Для чисел с плавающей точкой используется оператор "равно", а не
+        сравнение битов: +0.0 и -0.0 эквивалентны относительно "меньше".
+        */
+        template <class T>
+        T const * find_equivalent(T const * first, T const * last, T const & value,
+                                  std::false_type)
+        {
+        #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+            typedef simd_vector<T> Vector;
+
+            constexpr auto step = Vector::size;
+
+            auto const needle = Vector::broadcast(value);
+
+            for(; last - first >= step; first += step)
+            {
+                auto const m = Vector::mask(Vector::load(first) == needle);
+
+                if(m != 0)
+                {
+                    return first + __builtin_ctz(m) / sizeof(T);
+                }
+            }
+        #endif
+
+            for(; first != last; ++ first)
+            {
+                if(*first == value)
+                {
+                    return first;
+                }
+            }
+
+            return last;
+        }
+
+        // Отношения между соседними элементами, применимые и к векторам
+        struct elementwise_equal
+        {
+            template <class T>
+            auto operator()(T const & x, T const & y) const -> decltype(x == y)
+            {
+                return x == y;
+            }
+        };
+
+        struct elementwise_greater
+        {
+            template <class T>
+            auto operator()(T const & x, T const & y) const -> decltype(y < x)
+            {
+                return y < x;
+            }
+        };
+
+        /* Вектор элементов сравнивается с вектором, сдвинутым на один
+        элемент, а номер первой пары определяется по маске, как в find_value.
+        @return Указатель на первый элемент первой пары, для которой
+        выполняется отношение, или @c last, если такой пары нет.
+        */
+        template <class T, class Relation>
+        T const * adjacent_find_value(T const * first, T const * last,
+                                      Relation rel)
+        {
+            static_assert(is_simd_ordered<T>::value, "");
+
+            if(first == last)
+            {
+                return last;
+            }
+
+        #if defined(__GNUC__) && (defined(__AVX2__) || defined(__SSE2__))
+            typedef simd_vector<T> Vector;
+
+            constexpr auto step = Vector::size;
+
+            for(; last - first > step; first += step)
+            {
+                auto const m = Vector::mask(rel(Vector::load(first),
+                                                Vector::load(first + 1)));
+
+                if(m != 0)
+                {
+                    return first + __builtin_ctz(m) / sizeof(T);
+                }
+            }
+        #endif
+
+            for(auto next = first + 1; next != last; ++ first, (void) ++ next)
+            {
+                if(rel(*first, *next))
+                {
+                    return first;
+                }
+            }
+
+            return last;
+        }
+
+        /// @brief Множество однобайтовых значений
+        typedef std::bitset<UCHAR_MAX + 1> byte_set;
+
+        template <class Cursor, class T>
+        Cursor contiguous_find(Cursor in, T const & value)
+        {
+            value_type_t<Cursor> x;
+
+            auto const first = details::contiguous_data(in);
+            auto const last = first + in.size();
+
+            auto const pos = details::narrow_value(value, x)
+                           ? details::find_value<value_type_t<Cursor>>(first, last, x)
+                           : last;
+
+            in += (pos - first);
+
+            return in;
+        }
+
+        template <class Cursor1, class Cursor2>
+        tuple<Cursor1, Cursor2>
+        contiguous_mismatch(Cursor1 in1, Cursor2 in2)
+        {
+            auto const n = std::min<std::size_t>(in1.size(), in2.size());
+
+            auto const i = details::mismatch_index<value_type_t<Cursor1>>
+                (details::contiguous_data(in1), details::contiguous_data(in2), n);
+
+            in1 += i;
+            in2 += i;
+
+            return tuple<Cursor1, Cursor2>(std::move(in1), std::move(in2));
+        }
+
+        /* Копируется столько элементов, сколько их в более короткой из
+        последовательностей. memmove, а не memcpy, так как в отличие от
+        поэлементного копирования memcpy не допускает перекрытия.
+        */
+        template <class Input, class Output>
+        tuple<Input, Output>
+        contiguous_copy_n(Input in, std::size_t n, Output out)
+        {
+            n = std::min({n, static_cast<std::size_t>(in.size()),
+                          static_cast<std::size_t>(out.size())});
+
+            if(n > 0)
+            {
+                std::memmove(details::contiguous_data(out),
+                             details::contiguous_data(in),
+                             n * sizeof(value_type_t<Input>));
+            }
+
+            in += n;
+            out += n;
+
+            return tuple<Input, Output>(std::move(in), std::move(out));
+        }
+
+        template <class Input, class Output>
+        tuple<Input, Output>
+        contiguous_copy(Input in, Output out)
+        {
+            auto const n = in.size();
+
+            return details::contiguous_copy_n(std::move(in), n, std::move(out));
+        }
+
+        template <class Input, class Output>
+        tuple<Input, Output>
+        contiguous_copy_backward(Input in, Output out)
+        {
+            auto const n = std::min<std::size_t>(in.size(), out.size());
+
+            if(n > 0)
+            {
+                std::memmove(details::contiguous_data(out) + (out.size() - n),
+                             details::contiguous_data(in) + (in.size() - n),
+                             n * sizeof(value_type_t<Input>));
+            }
+
+            in.pop_back(n);
+            out.pop_back(n);
+
+            return tuple<Input, Output>(std::move(in), std::move(out));
+        }
+
+        /// @brief Размер буфера на стеке, используемого для отбора элементов
+        constexpr std::size_t filter_buffer_size = 1024;
+
+        /* Отбор без ветвлений: каждый элемент записывается в буфер, а позиция
+        записи увеличивается на значение предиката. На случайных данных это
+        избавляет от ошибок предсказания переходов. Возвращает количество
+        отобранных элементов.
+        */
+        template <class T, class Predicate>
+        std::size_t filter_block(T const * first, std::size_t n,
+                                 T * result, Predicate & pred)
+        {
+            std::size_t k = 0;
+
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                auto const x = first[i];
+                result[k] = x;
+                k += static_cast<bool>(pred(x));
+            }
+
+            return k;
+        }
+
+        /* Отобранные элементы сначала записываются в буфер на стеке, так
+        как безусловная запись прямо в out испортила бы элемент, следующий за
+        последним скопированным. Блоки не длиннее свободной части out, поэтому
+        переполнения не бывает. Как и filtered, после остановки пропускаются
+        элементы, не удовлетворяющие предикату.
+        */
+        template <class Input, class Output, class Predicate>
+        tuple<Input, Output>
+        contiguous_copy_if(Input in, Output out, Predicate & pred)
+        {
+            typedef value_type_t<Input> Value;
+
+            constexpr std::size_t block = filter_buffer_size / sizeof(Value);
+            static_assert(block > 0, "");
+
+            Value buffer[block];
+
+            auto const first = details::contiguous_data(in);
+            auto const result = details::contiguous_data(out);
+            std::size_t const n = in.size();
+            std::size_t const m = out.size();
+
+            std::size_t i = 0;
+            std::size_t j = 0;
+
+            for(;;)
+            {
+                auto const len = std::min({block, n - i, m - j});
+
+                if(len == 0)
+                {
+                    break;
+                }
+
+                auto const k = details::filter_block(first + i, len, buffer, pred);
+                std::memcpy(result + j, buffer, k * sizeof(Value));
+
+                i += len;
+                j += k;
+            }
+
+            for(; i != n && !pred(first[i]); ++ i)
+            {}
+
+            in += i;
+            out += j;
+
+            return tuple<Input, Output>(std::move(in), std::move(out));
+        }
+
+        /* Позиция записи не обгоняет позицию чтения, поэтому записывать можно
+        прямо в cur. Элемент, следующий за последним оставленным, может быть
+        изменён, что допустимо, так как значения устранённых элементов не
+        определены.
+        */
+        template <class Cursor, class Predicate>
+        Cursor contiguous_remove_if(Cursor cur, Predicate & pred)
+        {
+            auto const first = details::contiguous_data(cur);
+            std::size_t const n = cur.size();
+
+            std::size_t j = 0;
+
+            for(std::size_t i = 0; i != n; ++ i)
+            {
+                auto const x = first[i];
+                first[j] = x;
+                j += !static_cast<bool>(pred(x));
+            }
+
+            cur += j;
+
+            return cur;
+        }
+
+        /* Каждый элемент записывается в оба буфера, а сдвигается позиция
+        записи только одного из них. Как и при использовании partition_cursor,
+        копирование прекращается, когда исчерпана одна из выходных
+        последовательностей.
+        */
+        template <class Input, class Output1, class Output2, class Predicate>
+        tuple<Input, Output1, Output2>
+        contiguous_partition_copy(Input in, Output1 out_true, Output2 out_false,
+                                  Predicate & pred)
+        {
+            typedef value_type_t<Input> Value;
+
+            constexpr std::size_t block = filter_buffer_size / sizeof(Value);
+            static_assert(block > 0, "");
+
+            Value buffer_true[block];
+            Value buffer_false[block];
+
+            auto const first = details::contiguous_data(in);
+            auto const result_true = details::contiguous_data(out_true);
+            auto const result_false = details::contiguous_data(out_false);
+            std::size_t const n = in.size();
+            std::size_t const m_true = out_true.size();
+            std::size_t const m_false = out_false.size();
+
+            std::size_t i = 0;
+            std::size_t j_true = 0;
+            std::size_t j_false = 0;
+
+            for(;;)
+            {
+                auto const len = std::min({block, n - i, m_true - j_true,
+                                           m_false - j_false});
+
+                if(len == 0)
+                {
+                    break;
+                }
+
+                std::size_t k_true = 0;
+                std::size_t k_false = 0;
+
+                for(auto const * p = first + i; p != first + i + len; ++ p)
+                {
+                    auto const x = *p;
+                    bool const b = pred(x);
+
+                    buffer_true[k_true] = x;
+                    buffer_false[k_false] = x;
+                    k_true += b;
+                    k_false += !b;
+                }
+
+                std::memcpy(result_true + j_true, buffer_true,
+                            k_true * sizeof(Value));
+                std::memcpy(result_false + j_false, buffer_false,
+                            k_false * sizeof(Value));
+
+                i += len;
+                j_true += k_true;
+                j_false += k_false;
+            }
+
+            in += i;
+            out_true += j_true;
+            out_false += j_false;
+
+            return tuple<Input, Output1, Output2>(std::move(in),
+                                                  std::move(out_true),
+                                                  std::move(out_false));
+        }
+
+        /// @brief Размер буфера на стеке, используемого для поворота массивов
+        constexpr std::size_t rotate_buffer_size = 512;
+
+        /* Поворот массива из n1 + n2 элементов, при котором первые n1
+        элементов становятся последними. Выполняется, только если меньшая из
+        частей помещается в буфер.
+        */
+        template <class T>
+        bool contiguous_rotate_buffered(T * first, std::size_t n1, std::size_t n2)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "");
+
+            if(std::min(n1, n2) * sizeof(T) > rotate_buffer_size)
+            {
+                return false;
+            }
+
+            alignas(T) unsigned char buffer[rotate_buffer_size];
+
+            if(n1 <= n2)
+            {
+                std::memcpy(buffer, first, n1 * sizeof(T));
+                std::memmove(first, first + n1, n2 * sizeof(T));
+                std::memcpy(first + n2, buffer, n1 * sizeof(T));
+            }
+            else
+            {
+                std::memcpy(buffer, first + n1, n2 * sizeof(T));
+                std::memmove(first + n2, first, n1 * sizeof(T));
+                std::memcpy(first, buffer, n2 * sizeof(T));
+            }
+
+            return true;
+        }
+
+        /* Если все байты представления значения одинаковы (так обстоит дело
+        для однобайтовых типов и для нулей), то заполнение сводится к memset.
+        */
+        template <class T>
+        bool is_repeated_byte(T const & x, unsigned char & byte)
+        {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, std::addressof(x), sizeof(T));
+
+            byte = bytes[0];
+
+            return std::all_of(bytes + 1, bytes + sizeof(T),
+                               [byte](unsigned char b) { return b == byte; });
+        }
+
+        template <class Output, class T>
+        Output contiguous_fill_n(Output out, std::size_t n, T const & value)
+        {
+            typedef value_type_t<Output> Value;
+
+            n = std::min<std::size_t>(n, out.size());
+
+            if(n > 0)
+            {
+                auto const first = details::contiguous_data(out);
+                auto const x = static_cast<Value>(value);
+                unsigned char byte;
+
+                if(details::is_repeated_byte(x, byte))
+                {
+                    std::memset(first, byte, n * sizeof(Value));
+                }
+                else
+                {
+                    std::fill_n(first, n, x);
+                }
+            }
+
+            out += n;
+
+            return out;
+        }
+
+        template <class Cursor1, class Cursor2>
+        bool contiguous_equal(Cursor1 const & in1, Cursor2 const & in2)
+        {
+            auto const n = static_cast<std::size_t>(in1.size());
+
+            if(n != static_cast<std::size_t>(in2.size()))
+            {
+                return false;
+            }
+
+            return n == 0
+                   || std::memcmp(details::contiguous_data(in1),
+                                  details::contiguous_data(in2),
+                                  n * sizeof(value_type_t<Cursor1>)) == 0;
+        }
+
+        /* memcmp сравнивает байты как беззнаковые, поэтому для остальных типов
+        сравнивается только первая пара несовпадающих элементов.
+        */
+        template <class Cursor1, class Cursor2>
+        bool contiguous_lexicographical_compare(Cursor1 const & in1,
+                                                Cursor2 const & in2)
+        {
+            typedef value_type_t<Cursor1> Value;
+
+            auto const n1 = static_cast<std::size_t>(in1.size());
+            auto const n2 = static_cast<std::size_t>(in2.size());
+            auto const n = std::min(n1, n2);
+
+            auto const x = details::contiguous_data(in1);
+            auto const y = details::contiguous_data(in2);
+
+            if(n == 0)
+            {
+                return n1 < n2;
+            }
+
+            if(sizeof(Value) == 1 && std::is_unsigned<Value>::value)
+            {
+                auto const r = std::memcmp(x, y, n);
+
+                return r < 0 || (r == 0 && n1 < n2);
+            }
+
+            auto const i = details::mismatch_index<Value>(x, y, n);
+
+            return i == n ? n1 < n2 : x[i] < y[i];
+        }
+
+        template <class Cursor, class T>
+        difference_type_t<Cursor>
+        contiguous_count(Cursor const & in, T const & value)
+        {
+            value_type_t<Cursor> x;
+
+            if(!details::narrow_value(value, x))
+            {
+                return 0;
+            }
+
+            auto const first = details::contiguous_data(in);
+
+            return details::count_value<value_type_t<Cursor>>(first, first + in.size(), x);
+        }
+
+        template <class Cursor, class Relation>
+        Cursor contiguous_adjacent_find(Cursor in, Relation rel)
+        {
+            typedef value_type_t<Cursor> Value;
+
+            auto const first = details::contiguous_data(in);
+            auto const last = first + in.size();
+
+            in += details::adjacent_find_value<Value>(first, last, rel) - first;
+
+            return in;
+        }
+
+        /* Сначала за один проход определяются значения наименьшего и
+        наибольшего элементов, затем ищутся их первые вхождения. Если первый
+        элемент --- NaN, то ни один элемент не меньше и не больше его.
+        */
+        template <bool NeedMin, bool NeedMax, class Cursor>
+        tuple<Cursor, Cursor>
+        contiguous_minmax_element(Cursor in)
+        {
+            typedef value_type_t<Cursor> Value;
+
+            if(!in)
+            {
+                return tuple<Cursor, Cursor>(in, in);
+            }
+
+            auto const first = details::contiguous_data(in);
+            auto const last = first + in.size();
+
+            if(!(*first == *first))
+            {
+                return tuple<Cursor, Cursor>(in, in);
+            }
+
+            Value lo;
+            Value hi;
+            details::min_max_values<NeedMin, NeedMax>(first, last, lo, hi);
+
+            using Integral = std::is_integral<Value>;
+
+            auto in_min = in;
+            auto in_max = in;
+
+            if(NeedMin)
+            {
+                in_min += details::find_equivalent<Value>(first, last, lo, Integral{}) - first;
+            }
+            if(NeedMax)
+            {
+                in_max += details::find_equivalent<Value>(first, last, hi, Integral{}) - first;
+            }
+
+            return tuple<Cursor, Cursor>(std::move(in_min), std::move(in_max));
+        }
+    }
+    // namespace details
+    /// @endcond
+}
+// namespace v1
+}
+// namespace ural
+
+#endif
+// Z_URAL_ALGORITHM_CONTIGUOUS_HPP_INCLUDED
@@ -24,6 +24,7 @@
  в свой код, только если это действительно необходимо.
 */
 
+#include <ural/algorithm/contiguous.hpp>
 #include <ural/sequence/make.hpp>
 #include <ural/concepts.hpp>
 #include <ural/tuple.hpp>
@@ -49,6 +50,22 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::SinglePassCursor<Output>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Input, Output>));
 
+            using Contiguous = details::use_contiguous_copy<Input, Output>;
+
+            return copy_fn::copy_impl(std::move(in), std::move(out), Contiguous{});
+        }
+
+        template <class Input, class Output>
+        static ural::tuple<Input, Output>
+        copy_impl(Input in, Output out, std::true_type)
+        {
+            return details::contiguous_copy(std::move(in), std::move(out));
+        }
+
+        template <class Input, class Output>
+        static ural::tuple<Input, Output>
+        copy_impl(Input in, Output out, std::false_type)
+        {
             for(; !!in && !!out; ++ in, (void) ++ out)
             {
                 *out = *in;
@@ -138,6 +155,23 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<BinaryPredicate, Input, T const *>));
 
+            using Contiguous = details::use_contiguous_find<Input, T, BinaryPredicate>;
+
+            return find_fn::impl(std::move(in), value, std::move(bin_pred),
+                                 Contiguous{});
+        }
+
+        template <class Input, class T, class BinaryPredicate>
+        static Input
+        impl(Input in, T const & value, BinaryPredicate, std::true_type)
+        {
+            return details::contiguous_find(std::move(in), value);
+        }
+
+        template <class Input, class T, class BinaryPredicate>
+        static Input
+        impl(Input in, T const & value, BinaryPredicate bin_pred, std::false_type)
+        {
             auto pred = [&](auto const & x) { return bin_pred(x, value); };
 
             return find_if_fn{}(std::move(in), std::move(pred));
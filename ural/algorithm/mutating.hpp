@@ -45,6 +45,10 @@
 #include <ural/sequence/generator.hpp>
 #include <ural/algorithm/non_modifying.hpp>
 #include <ural/algorithm/core.hpp>
+#include <ural/math/common_factor.hpp>
+#include <ural/random/uniform_index.hpp>
+
+#include <new>
 
 namespace ural
 {
@@ -53,6 +57,11 @@ inline namespace v1
 /// @cond false
 namespace details
 {
+    /** Размер (в байтах) интервала, который поворачивается перестановкой
+    циклами. Для более длинных интервалов используется обмен блоков.
+    */
+    constexpr std::size_t rotate_juggling_size = 1 << 15;
+
     // Бинарные кучи
     template <class Size>
     Size heap_parent(Size pos)
@@ -87,6 +96,171 @@ namespace details
             index = parent;
         }
     }
+
+    /* Буфер для временного хранения элементов. Если выделить память под
+    запрошенное количество элементов не удаётся, то количество уменьшается
+    вдвое, пока оно не станет равным нулю. Элементы создаются в буфере
+    функциями move_from и push_back и уничтожаются функцией clear.
+    */
+    template <class T>
+    class temporary_buffer
+    {
+    public:
+        explicit temporary_buffer(std::ptrdiff_t n)
+         : data_(nullptr)
+         , capacity_(0)
+         , size_(0)
+        {
+            for(; n > 0; n /= 2)
+            {
+                auto const bytes = static_cast<std::size_t>(n) * sizeof(T);
+                data_ = static_cast<T*>(::operator new(bytes, std::nothrow));
+
+                if(data_ != nullptr)
+                {
+                    capacity_ = n;
+                    break;
+                }
+            }
+        }
+
+        temporary_buffer(temporary_buffer const &) = delete;
+        temporary_buffer & operator=(temporary_buffer const &) = delete;
+
+        ~temporary_buffer()
+        {
+            this->clear();
+            ::operator delete(data_);
+        }
+
+        template <class RACursor>
+        void move_from(RACursor cur, difference_type_t<RACursor> first,
+                       difference_type_t<RACursor> n)
+        {
+            assert(size_ == 0);
+            assert(n <= capacity_);
+
+            for(; size_ != n; ++ size_)
+            {
+                ::new(static_cast<void*>(data_ + size_))
+                    T(std::move(cur[first + size_]));
+            }
+        }
+
+        /* Создание элемента в конце буфера. Если конструктор возбуждает
+        исключение, то ранее созданные элементы остаются в буфере.
+        */
+        template <class U>
+        void push_back(U && x)
+        {
+            assert(size_ < capacity_);
+
+            ::new(static_cast<void*>(data_ + size_)) T(std::forward<U>(x));
+            ++ size_;
+        }
+
+        /* Создание элемента с номером i, уничтожать который будет буфер.
+        После того, как созданы элементы [0, n), нужно вызвать
+        assume_constructed(n).
+        */
+        template <class U>
+        void construct(std::ptrdiff_t i, U && x)
+        {
+            assert(0 <= i && i < capacity_);
+
+            ::new(static_cast<void*>(data_ + i)) T(std::forward<U>(x));
+        }
+
+        /* Уничтожение элемента с номером i, созданного функцией construct,
+        до вызова assume_constructed.
+        */
+        void destroy(std::ptrdiff_t i)
+        {
+            assert(size_ == 0);
+            assert(0 <= i && i < capacity_);
+
+            data_[i].~T();
+        }
+
+        void assume_constructed(std::ptrdiff_t n)
+        {
+            assert(size_ == 0);
+            assert(n <= capacity_);
+
+            size_ = n;
+        }
+
+        void clear()
+        {
+            for(; size_ > 0; -- size_)
+            {
+                data_[size_ - 1].~T();
+            }
+        }
+
+        T * data() const
+        {
+            return data_;
+        }
+
+        T & operator[](std::ptrdiff_t i) const
+        {
+            assert(0 <= i && i < size_);
+            return data_[i];
+        }
+
+        std::ptrdiff_t capacity() const
+        {
+            return capacity_;
+        }
+
+    private:
+        T * data_;
+        std::ptrdiff_t capacity_;
+        std::ptrdiff_t size_;
+    };
+
+    /* Буфер, заполняемый функцией push_back, как и temporary_buffer, но
+    элементы которого предоставлены вызывающим кодом в виде курсора
+    произвольного доступа. Вместо создания элементов выполняется присваивание.
+    */
+    template <class RACursor>
+    class cursor_scratch
+    {
+    public:
+        explicit cursor_scratch(RACursor cur)
+         : cur_(std::move(cur))
+         , size_(0)
+        {}
+
+        std::ptrdiff_t capacity() const
+        {
+            return cur_.size();
+        }
+
+        template <class U>
+        void push_back(U && x)
+        {
+            assert(size_ < this->capacity());
+
+            cur_[size_] = std::forward<U>(x);
+            ++ size_;
+        }
+
+        void clear()
+        {
+            size_ = 0;
+        }
+
+        reference_type_t<RACursor> operator[](std::ptrdiff_t i) const
+        {
+            return cur_[i];
+        }
+
+    private:
+        RACursor cur_;
+        std::ptrdiff_t size_;
+    };
 }
 // namespace details
 /// @endcond
@@ -117,18 +291,47 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<cursor_type_t<Input>,
                                                                cursor_type_t<Output>>));
 
+            return this->impl(::ural::cursor_fwd<Input>(in), std::move(n),
+                              ::ural::cursor_fwd<Output>(out));
+        }
+
+    private:
+        template <class Input, class Output>
+        static tuple<Input, Output>
+        impl(Input in, difference_type_t<Input> n, Output out)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input>));
+            BOOST_CONCEPT_ASSERT((concepts::SinglePassCursor<Output>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Input, Output>));
+
             if(n < 0)
             {
-                return ural::make_tuple(::ural::cursor_fwd<Input>(in),
-                                        ::ural::cursor_fwd<Output>(out));
+                return tuple<Input, Output>(std::move(in), std::move(out));
             }
 
-            auto in_n = ::ural::cursor_fwd<Input>(in) | ::ural::experimental::taken(n);
+            using Contiguous = details::use_contiguous_copy<Input, Output>;
 
-            auto result = ::ural::copy_fn{}(std::move(in_n),
-                                            ::ural::cursor_fwd<Output>(out));
-            return ural::make_tuple(std::move(result[ural::_1]).base(),
-                                    std::move(result[ural::_2]));
+            return copy_n_fn::impl(std::move(in), std::move(n), std::move(out),
+                                   Contiguous{});
+        }
+
+        template <class Input, class Output>
+        static tuple<Input, Output>
+        impl(Input in, difference_type_t<Input> n, Output out, std::true_type)
+        {
+            return details::contiguous_copy_n(std::move(in), n, std::move(out));
+        }
+
+        template <class Input, class Output>
+        static tuple<Input, Output>
+        impl(Input in, difference_type_t<Input> n, Output out, std::false_type)
+        {
+            auto in_n = std::move(in) | ::ural::experimental::taken(n);
+
+            auto result = ::ural::copy_fn{}(std::move(in_n), std::move(out));
+
+            return tuple<Input, Output>(std::move(result[ural::_1]).base(),
+                                        std::move(result[ural::_2]));
         }
     };
 
@@ -158,9 +361,29 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<cursor_type_t<Input>,
                                                                cursor_type_t<Output>>));
 
-            auto in_f = ::ural::cursor_fwd<Input>(in) | ::ural::experimental::filtered(pred);
-            auto res = ural::copy_fn{}(std::move(in_f),
-                                       ::ural::cursor_fwd<Output>(out));
+            using Contiguous = details::use_contiguous_filter<cursor_type_t<Input>,
+                                                              cursor_type_t<Output>>;
+
+            return copy_if_fn::impl(::ural::cursor_fwd<Input>(in),
+                                    ::ural::cursor_fwd<Output>(out),
+                                    ::ural::make_callable(std::move(pred)),
+                                    Contiguous{});
+        }
+
+    private:
+        template <class Input, class Output, class Predicate>
+        static tuple<Input, Output>
+        impl(Input in, Output out, Predicate pred, std::true_type)
+        {
+            return details::contiguous_copy_if(std::move(in), std::move(out), pred);
+        }
+
+        template <class Input, class Output, class Predicate>
+        static tuple<Input, Output>
+        impl(Input in, Output out, Predicate pred, std::false_type)
+        {
+            auto in_f = std::move(in) | ::ural::experimental::filtered(std::move(pred));
+            auto res = ural::copy_fn{}(std::move(in_f), std::move(out));
 
             return ural::make_tuple(std::move(res[ural::_1]).base(),
                                     std::move(res[ural::_2]));
@@ -204,6 +427,22 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::BidirectionalCursor<Bidir2>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Bidir1, Bidir2>));
 
+            using Contiguous = details::use_contiguous_copy<Bidir1, Bidir2>;
+
+            return this->impl(std::move(in), std::move(out), Contiguous{});
+        }
+
+        template <class Bidir1, class Bidir2>
+        tuple<Bidir1, Bidir2>
+        impl(Bidir1 in, Bidir2 out, std::true_type) const
+        {
+            return details::contiguous_copy_backward(std::move(in), std::move(out));
+        }
+
+        template <class Bidir1, class Bidir2>
+        tuple<Bidir1, Bidir2>
+        impl(Bidir1 in, Bidir2 out, std::false_type) const
+        {
             auto res = ural::copy_fn{}(std::move(in) | ::ural::experimental::reversed,
                                        std::move(out) | ::ural::experimental::reversed);
 
@@ -237,11 +476,41 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyMovable<cursor_type_t<Input>,
                                                               cursor_type_t<Output>>));
 
-            auto in_moved = ::ural::cursor_fwd<Input>(in) | ::ural::experimental::moved;
-            auto res = ural::copy_fn{}(std::move(in_moved),
-                                       ::ural::cursor_fwd<Output>(out));
-            return ural::make_tuple(std::move(res[ural::_1]).base(),
-                                    std::move(res[ural::_2]));
+            return this->impl(::ural::cursor_fwd<Input>(in),
+                              ::ural::cursor_fwd<Output>(out));
+        }
+
+    private:
+        template <class Input, class Output>
+        static tuple<Input, Output>
+        impl(Input in, Output out)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input>));
+            BOOST_CONCEPT_ASSERT((concepts::SinglePassCursor<Output>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyMovable<Input, Output>));
+
+            // Перемещение тривиально копируемых объектов --- это копирование
+            using Contiguous = details::use_contiguous_copy<Input, Output>;
+
+            return move_fn::impl(std::move(in), std::move(out), Contiguous{});
+        }
+
+        template <class Input, class Output>
+        static tuple<Input, Output>
+        impl(Input in, Output out, std::true_type)
+        {
+            return details::contiguous_copy(std::move(in), std::move(out));
+        }
+
+        template <class Input, class Output>
+        static tuple<Input, Output>
+        impl(Input in, Output out, std::false_type)
+        {
+            auto res = ural::copy_fn{}(std::move(in) | ::ural::experimental::moved,
+                                       std::move(out));
+
+            return tuple<Input, Output>(std::move(res[ural::_1]).base(),
+                                        std::move(res[ural::_2]));
         }
     };
 
@@ -282,6 +551,22 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::BidirectionalCursor<Bidir2>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyMovable<Bidir1, Bidir2>));
 
+            using Contiguous = details::use_contiguous_copy<Bidir1, Bidir2>;
+
+            return this->impl(std::move(in), std::move(out), Contiguous{});
+        }
+
+        template <class Bidir1, class Bidir2>
+        tuple<Bidir1, Bidir2>
+        impl(Bidir1 in, Bidir2 out, std::true_type) const
+        {
+            return details::contiguous_copy_backward(std::move(in), std::move(out));
+        }
+
+        template <class Bidir1, class Bidir2>
+        tuple<Bidir1, Bidir2>
+        impl(Bidir1 in, Bidir2 out, std::false_type) const
+        {
             auto res = ural::move_fn{}(std::move(in) | ::ural::experimental::reversed
                                        | ::ural::experimental::moved,
                                        std::move(out) | ::ural::experimental::reversed);
@@ -581,6 +866,24 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::Semiregular<T>));
             BOOST_CONCEPT_ASSERT((concepts::OutputCursor<Output, T>));
 
+            using Contiguous = details::use_contiguous_fill<Output, T>;
+
+            return fill_fn::impl(std::move(seq), value, Contiguous{});
+        }
+
+        template <class Output, class T>
+        static Output
+        impl(Output seq, T const & value, std::true_type)
+        {
+            auto const n = seq.size();
+
+            return details::contiguous_fill_n(std::move(seq), n, value);
+        }
+
+        template <class Output, class T>
+        static Output
+        impl(Output seq, T const & value, std::false_type)
+        {
             return generate_fn{}(std::move(seq),
                                  ::ural::experimental::value_function<T const &>(value));
         }
@@ -609,9 +912,34 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::Sequence<Output>));
             BOOST_CONCEPT_ASSERT((concepts::OutputCursor<cursor_type_t<Output>, T>));
 
+            using Contiguous = details::use_contiguous_fill<cursor_type_t<Output>, T>;
+
+            return this->impl(::ural::cursor_fwd<Output>(out), std::move(n),
+                              value, Contiguous{});
+        }
+
+    private:
+        template <class Output, class T>
+        static Output
+        impl(Output out, difference_type_t<Output> n, T const & value,
+             std::true_type)
+        {
+            if(n <= 0)
+            {
+                return out;
+            }
+
+            return details::contiguous_fill_n(std::move(out), n, value);
+        }
+
+        template <class Output, class T>
+        static Output
+        impl(Output out, difference_type_t<Output> n, T const & value,
+             std::false_type)
+        {
             auto gen = ::ural::experimental::value_function<T const &>(value);
-            return ::ural::generate_n_fn{}(std::forward<Output>(out),
-                                           std::move(n), std::move(gen));
+            return ::ural::generate_n_fn{}(std::move(out), std::move(n),
+                                           std::move(gen));
         }
     };
 
@@ -856,6 +1184,22 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<Predicate, ForwardCursor>));
             BOOST_CONCEPT_ASSERT((concepts::Permutable<ForwardCursor>));
 
+            using Contiguous = details::use_contiguous_filter<ForwardCursor, ForwardCursor>;
+
+            return this->impl(std::move(in), std::move(pred), Contiguous{});
+        }
+
+        template <class ForwardCursor, class Predicate>
+        ForwardCursor
+        impl(ForwardCursor in, Predicate pred, std::true_type) const
+        {
+            return details::contiguous_remove_if(std::move(in), pred);
+        }
+
+        template <class ForwardCursor, class Predicate>
+        ForwardCursor
+        impl(ForwardCursor in, Predicate pred, std::false_type) const
+        {
             auto out = find_if_fn{}(std::move(in), pred);
 
             if(!out)
@@ -1283,12 +1627,160 @@ namespace details
 
             auto seq_old = seq.original();
 
-            this->impl(seq.traversed_front(), ural::shrink_front_copy(seq));
+            this->impl_parts(seq, ::ural::make_cursor_tag(seq.traversed_front()));
 
             // @todo оптимизация
             ural::advance(seq_old, ural::size(seq));
             return seq_old;
         }
+
+        // Обмен блоков (Gries-Mills)
+        template <class ForwardCursor>
+        void impl_parts(ForwardCursor const & seq, forward_cursor_tag) const
+        {
+            this->impl(seq.traversed_front(), ural::shrink_front_copy(seq));
+        }
+
+        // Три обращения
+        template <class BidirectionalCursor>
+        void impl_parts(BidirectionalCursor const & seq,
+                        bidirectional_cursor_tag) const
+        {
+            ::ural::reverse_fn{}(seq.traversed_front());
+            ::ural::reverse_fn{}(ural::shrink_front_copy(seq));
+            ::ural::reverse_fn{}(seq);
+        }
+
+        template <class RandomAccessCursor>
+        void impl_parts(RandomAccessCursor const & seq,
+                        finite_random_access_cursor_tag) const
+        {
+            auto all = seq;
+            ural::exhaust_front(all);
+
+            auto cur = all.traversed_front();
+            auto const n2 = seq.size();
+            auto const n1 = cur.size() - n2;
+
+            using Contiguous = details::use_contiguous_copy<decltype(cur), decltype(cur)>;
+
+            this->impl_random_access(std::move(cur), n1, n2, Contiguous{});
+        }
+
+        /* Обмен блоков выполняется до тех пор, пока меньшая из частей не
+        поместится в буфер на стеке или весь интервал не поместится в кэш.
+        */
+        template <class RandomAccessCursor, class Contiguous>
+        void impl_random_access(RandomAccessCursor cur,
+                                difference_type_t<RandomAccessCursor> n1,
+                                difference_type_t<RandomAccessCursor> n2,
+                                Contiguous) const
+        {
+            using Value = value_type_t<RandomAccessCursor>;
+
+            difference_type_t<RandomAccessCursor> first = 0;
+
+            for(;;)
+            {
+                if(n1 == 0 || n2 == 0)
+                {
+                    return;
+                }
+
+                if(this->impl_buffered(cur, first, n1, n2, Contiguous{}))
+                {
+                    return;
+                }
+
+                auto const last = first + n1 + n2;
+
+                if(static_cast<std::size_t>(n1 + n2) * sizeof(Value) <= details::rotate_juggling_size)
+                {
+                    this->impl_juggling(details::random_access_subcursor(cur, first, last),
+                                        n1, n2);
+                    return;
+                }
+
+                if(n1 <= n2)
+                {
+                    // A B' B'' -> B'' B' A, |B''| = |A|
+                    ::ural::swap_ranges_fn{}(details::random_access_subcursor(cur, first, first + n1),
+                                             details::random_access_subcursor(cur, last - n1, last));
+                    n2 -= n1;
+                }
+                else
+                {
+                    // A' A'' B -> B A'' A', |A'| = |B|
+                    ::ural::swap_ranges_fn{}(details::random_access_subcursor(cur, first, first + n2),
+                                             details::random_access_subcursor(cur, last - n2, last));
+                    first += n2;
+                    n1 -= n2;
+                }
+            }
+        }
+
+        template <class RandomAccessCursor>
+        static bool impl_buffered(RandomAccessCursor const & cur,
+                                  difference_type_t<RandomAccessCursor> first,
+                                  difference_type_t<RandomAccessCursor> n1,
+                                  difference_type_t<RandomAccessCursor> n2,
+                                  std::true_type)
+        {
+            return details::contiguous_rotate_buffered(details::contiguous_data(cur) + first,
+                                                       n1, n2);
+        }
+
+        template <class RandomAccessCursor>
+        static bool impl_buffered(RandomAccessCursor const &,
+                                  difference_type_t<RandomAccessCursor>,
+                                  difference_type_t<RandomAccessCursor>,
+                                  difference_type_t<RandomAccessCursor>,
+                                  std::false_type)
+        {
+            return false;
+        }
+
+        /* Перестановка циклами (juggling): элемент с индексом i заменяется
+        элементом с индексом (i + n1) mod n, всего gcd(n1, n2) циклов.
+        Каждый элемент перемещается ровно один раз, но обращения к памяти
+        идут с шагом n1, поэтому алгоритм применяется только к интервалам,
+        помещающимся в кэш.
+        */
+        template <class RandomAccessCursor>
+        static void impl_juggling(RandomAccessCursor cur,
+                                  difference_type_t<RandomAccessCursor> n1,
+                                  difference_type_t<RandomAccessCursor> n2)
+        {
+            auto const n = n1 + n2;
+            auto const cycles = ::ural::experimental::gcd(n1, n2);
+
+            for(difference_type_t<RandomAccessCursor> start = 0; start != cycles; ++ start)
+            {
+                value_type_t<RandomAccessCursor> tmp = std::move(cur[start]);
+
+                auto pos = start;
+
+                for(;;)
+                {
+                    auto next = pos + n1;
+
+                    if(next >= n)
+                    {
+                        next -= n;
+                    }
+
+                    if(next == start)
+                    {
+                        break;
+                    }
+
+                    cur[pos] = std::move(cur[next]);
+                    pos = next;
+                }
+
+                cur[pos] = std::move(tmp);
+            }
+        }
     };
 
     /** @ingroup MutatingSequenceOperations
@@ -1372,18 +1864,155 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::Permutable<RACursor>));
             BOOST_CONCEPT_ASSERT((concepts::Convertible<result_type_t<URNG>, difference_type_t<RACursor>>));
 
+            auto index = ::ural::experimental::make_uniform_index_generator(g);
+
             for(; !!s; ++s)
             {
-                std::uniform_int_distribution<decltype(s.size())>
-                    d(0, s.size() - 1);
-                auto index = d(g);
-                ::ural::indirect_swap(s, index, s, front);
+                auto const pos = static_cast<difference_type_t<RACursor>>(index(s.size()));
+                ::ural::indirect_swap(s, pos, s, front);
             }
 
             return s;
         }
     };
 
+    /** @ingroup MutatingSequenceOperations
+    @brief Тип функционального объекта для получения случайной выборки без
+    возвращения.
+    */
+    class sample_fn
+    {
+    public:
+        /** Если @c in --- прямая последовательность, то используется
+        последовательная выборка (Кнут, алгоритм S): каждый элемент копируется
+        с вероятностью, равной отношению количества ещё не выбранных элементов
+        к количеству ещё не просмотренных. Выбранные элементы записываются в
+        @c out в том же порядке, в каком они следуют в @c in. Для
+        однопроходных последовательностей используется выборка с резервуаром
+        (алгоритм R), @c out при этом должна быть последовательностью
+        произвольного доступа, а порядок выбранных элементов не сохраняется.
+        @brief Случайная выборка заданного количества элементов
+        @param in входная последовательность
+        @param out выходная последовательность
+        @param n размер выборки
+        @param g генератор равномерно распределённых случайных чисел
+        @return Кортеж, содержащий непройденные части входной и выходной
+        последовательностей. Будет записано
+        <tt> min(n, size(in)) </tt> элементов, но не больше, чем вмещает
+        @c out. Если @c out --- конечная прямая последовательность, то @c n
+        предварительно уменьшается до её размера, так что каждый элемент
+        @c in попадает в выборку с одинаковой вероятностью.
+        */
+        template <class Input, class Output, class URNG>
+        tuple<cursor_type_t<Input>, cursor_type_t<Output>>
+        operator()(Input && in, Output && out,
+                   difference_type_t<cursor_type_t<Input>> n, URNG && g) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::InputSequence<Input>));
+            BOOST_CONCEPT_ASSERT((concepts::SinglePassSequence<Output>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<cursor_type_t<Input>,
+                                                               cursor_type_t<Output>>));
+            BOOST_CONCEPT_ASSERT((concepts::Uniform_random_number_generator<typename std::decay<URNG>::type>));
+
+            auto in_cur = ::ural::cursor_fwd<Input>(in);
+            auto const tag = ::ural::make_cursor_tag(in_cur);
+
+            return this->impl(std::move(in_cur), ::ural::cursor_fwd<Output>(out),
+                              std::move(n), g, tag);
+        }
+
+    private:
+        template <class Forward, class Output, class URNG>
+        static tuple<Forward, Output>
+        impl(Forward in, Output out, difference_type_t<Forward> n, URNG & g,
+             finite_forward_cursor_tag)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
+            BOOST_CONCEPT_ASSERT((concepts::SinglePassCursor<Output>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Forward, Output>));
+
+            // Иначе при нехватке места выборка смещалась бы к началу in
+            n = sample_fn::clamp_to_output(n, out, ::ural::make_cursor_tag(out));
+
+            auto index = ::ural::experimental::make_uniform_index_generator(g);
+
+            auto unseen = ::ural::size(in);
+
+            for(; n > 0 && !!in && !!out; ++ in)
+            {
+                if(static_cast<difference_type_t<Forward>>(index(unseen)) < n)
+                {
+                    *out = *in;
+                    ++ out;
+                    -- n;
+                }
+
+                -- unseen;
+            }
+
+            ural::exhaust_front(in);
+
+            return tuple<Forward, Output>(std::move(in), std::move(out));
+        }
+
+        template <class Size, class Output>
+        static Size clamp_to_output(Size n, Output const & out,
+                                    finite_forward_cursor_tag)
+        {
+            return std::min<Size>(n, ::ural::size(out));
+        }
+
+        template <class Size, class Output>
+        static Size clamp_to_output(Size n, Output const &, single_pass_cursor_tag)
+        {
+            return n;
+        }
+
+        template <class Input, class RAOutput, class URNG>
+        static tuple<Input, RAOutput>
+        impl(Input in, RAOutput out, difference_type_t<Input> n, URNG & g,
+             single_pass_cursor_tag)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input>));
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RAOutput>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Input, RAOutput>));
+
+            if(n <= 0)
+            {
+                return tuple<Input, RAOutput>(std::move(in), std::move(out));
+            }
+
+            using Size = difference_type_t<RAOutput>;
+
+            auto const k = std::min<Size>(n, out.size());
+
+            Size filled = 0;
+
+            for(; filled < k && !!in; ++ in, (void) ++ filled)
+            {
+                out[filled] = *in;
+            }
+
+            auto index = ::ural::experimental::make_uniform_index_generator(g);
+
+            for(auto seen = filled; !!in; ++ in)
+            {
+                ++ seen;
+
+                auto const pos = static_cast<Size>(index(seen));
+
+                if(pos < k)
+                {
+                    out[pos] = *in;
+                }
+            }
+
+            out += filled;
+
+            return tuple<Input, RAOutput>(std::move(in), std::move(out));
+        }
+    };
+
     // Разделение
     /** @ingroup PartitioningOperations
     @brief Тип функционального объекта для проверки того, последовательность
@@ -1490,6 +2119,12 @@ namespace details
     {
     public:
         /** @brief Разделение последовательности в соответствие с предикатом
+        @details Элементы, не удовлетворяющие предикату, перемещаются во
+        временный буфер, а затем возвращаются на место после остальных
+        элементов, поэтому требуется линейное число перемещений. Если выделить
+        буфер достаточного размера не удаётся, то используется рекурсивное
+        разделение с поворотами, требующее <tt> O(N log N) </tt> перемещений,
+        причём части, которые помещаются в буфер, разделяются с его помощью.
         @param in последовательность
         @param pred предикат
         @post Переставляет элементы @c in таким образом, что все элемнты,
@@ -1511,14 +2146,116 @@ namespace details
                                                               cursor_type_t<ForwardSequence>>));
             BOOST_CONCEPT_ASSERT((concepts::Permutable<cursor_type_t<ForwardSequence>>));
 
-            return this->impl(::ural::cursor_fwd<ForwardSequence>(in),
-                              ::ural::make_callable(std::move(pred)));
+            using Value = value_type_t<cursor_type_t<ForwardSequence>>;
+
+            auto cur = ::ural::cursor_fwd<ForwardSequence>(in);
+            cur.shrink_front();
+            cur = find_if_not_fn{}(std::move(cur), pred);
+
+            details::temporary_buffer<Value> buffer(ural::size(cur));
+
+            return this->impl(std::move(cur),
+                              ::ural::make_callable(std::move(pred)), buffer);
+        }
+
+        /** @brief Разделение последовательности в соответствие с предикатом с
+        использованием заданного буфера.
+        @details В отличие от варианта без буфера, память не выделяется. Если
+        размер @c scratch не меньше количества элементов @c in, не
+        удовлетворяющих @c pred, то требуется линейное число перемещений.
+        @param in последовательность
+        @param pred предикат
+        @param scratch последовательность, элементы которой используются
+        для временного хранения элементов @c in. После завершения работы их
+        значения не определены.
+        @return Последовательность @c r такая, что:
+        <tt> original(r) == cursor_fwd<ForwardSequence>(in) </tt>,
+        <tt> all_of(r.traversed_front(), pred) != false </tt> и
+        <tt> none_of(r, pred) != false </tt>.
+        */
+        template <class ForwardSequence, class UnaryPredicate, class RASequence>
+        cursor_type_t<ForwardSequence>
+        operator()(ForwardSequence && in, UnaryPredicate pred,
+                   RASequence && scratch) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<ForwardSequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<UnaryPredicate,
+                                                              cursor_type_t<ForwardSequence>>));
+            BOOST_CONCEPT_ASSERT((concepts::Permutable<cursor_type_t<ForwardSequence>>));
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+
+            using Scratch = details::cursor_scratch<cursor_type_t<RASequence>>;
+            Scratch buffer(::ural::cursor_fwd<RASequence>(scratch));
+
+            auto cur = ::ural::cursor_fwd<ForwardSequence>(in);
+            cur.shrink_front();
+            cur = find_if_not_fn{}(std::move(cur), pred);
+
+            return this->impl(std::move(cur),
+                              ::ural::make_callable(std::move(pred)), buffer);
         }
 
     private:
-        template <class ForwardCursor, class UnaryPredicate>
+        template <class ForwardCursor, class UnaryPredicate, class Buffer>
         ForwardCursor
-        impl_inplace(ForwardCursor in, UnaryPredicate pred) const
+        impl_buffered(ForwardCursor in, UnaryPredicate pred, Buffer & buffer) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<ForwardCursor>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<UnaryPredicate, ForwardCursor>));
+            BOOST_CONCEPT_ASSERT((concepts::Permutable<ForwardCursor>));
+
+            assert(!!in);
+            assert(!pred(*in));
+            assert(!in.traversed_front());
+
+            // Первый элемент не удовлетворяет предикату, поэтому out всегда
+            // отстаёт от in и перемещение элемента в себя невозможно
+            auto out = in;
+            std::ptrdiff_t n_false = 0;
+
+            // Элементы из буфера записываются на n_false позиций, начиная с
+            // tail: после просмотра это хвост, а при исключении --- элементы
+            // [out, in), из которых они были перемещены
+            auto move_back = [&](ForwardCursor tail)
+            {
+                for(std::ptrdiff_t i = 0; i != n_false; ++ i, ++ tail)
+                {
+                    *tail = std::move(buffer[i]);
+                }
+
+                buffer.clear();
+            };
+
+            try
+            {
+                for(; !!in; ++ in)
+                {
+                    if(pred(*in))
+                    {
+                        *out = std::move(*in);
+                        ++ out;
+                    }
+                    else
+                    {
+                        buffer.push_back(std::move(*in));
+                        ++ n_false;
+                    }
+                }
+            }
+            catch(...)
+            {
+                move_back(out);
+                throw;
+            }
+
+            move_back(ural::shrink_front_copy(out));
+
+            return out;
+        }
+
+        template <class ForwardCursor, class UnaryPredicate, class Buffer>
+        ForwardCursor
+        impl_inplace(ForwardCursor in, UnaryPredicate pred, Buffer & buffer) const
         {
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<ForwardCursor>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<UnaryPredicate, ForwardCursor>));
@@ -1538,51 +2275,81 @@ namespace details
                 return s_orig;
             }
 
+            if(n <= buffer.capacity())
+            {
+                return this->impl_buffered(s_orig, pred, buffer);
+            }
+
             // Разделяем первую половину
             auto const n_left = n/2;
             auto s = ural::next(s_orig, n_left);
 
-            auto r_left = this->impl_inplace(s.traversed_front(), pred);
+            auto r_left = this->impl_inplace(s.traversed_front(), pred, buffer);
 
             // Разделяем вторую половину
             auto s_right = find_if_not_fn{}(ural::shrink_front_copy(s), pred);
 
             if(!!s_right)
             {
-                auto r_right = this->impl_inplace(ural::shrink_front_copy(s_right), pred);
+                auto r_right = this->impl_inplace(ural::shrink_front_copy(s_right),
+                                                  pred, buffer);
                 ural::advance(s_right, ural::size(r_right.traversed_front()));
             }
 
             // Поворачиваем
-            auto r = ::ural::rotate_fn{}(ural::shrink_front_copy(r_left),
-                                         s_right.traversed_front());
+            auto const nt_left = ::ural::size(r_left.traversed_front());
+            auto const nt_right = ::ural::size(s_right.traversed_front());
+
+            this->rotate_parts(s_orig, nt_left, n_left, n_left + nt_right,
+                               ::ural::make_cursor_tag(s_orig));
 
             // Возвращаем результат
-            auto nt = ::ural::size(r_left.traversed_front());
-            nt += ::ural::size(r[ural::_1].traversed_front());
+            return ural::next(s_orig, nt_left + nt_right);
+        }
+
+        /* Поворот интервала [first, last) курсора cur вокруг элемента с
+        номером middle.
+        */
+        template <class ForwardCursor, class Size>
+        void rotate_parts(ForwardCursor const & cur, Size first, Size middle,
+                          Size last, forward_cursor_tag) const
+        {
+            auto s1 = ural::shrink_front_copy(ural::next(cur, first));
+            ural::advance(s1, middle - first);
+
+            auto s2 = ural::next(ural::shrink_front_copy(s1), last - middle);
 
-            return ural::next(s_orig, nt);
+            ::ural::rotate_fn{}(s1.traversed_front(), s2.traversed_front());
         }
 
-        template <class ForwardCursor, class UnaryPredicate>
+        // Поворот одной последовательности не использует рекурсию
+        template <class BidirectionalCursor, class Size>
+        void rotate_parts(BidirectionalCursor const & cur, Size first,
+                          Size middle, Size last, bidirectional_cursor_tag) const
+        {
+            auto s = ural::shrink_front_copy(ural::next(cur, first));
+            ural::pop_back_n(s, ural::size(s) - (last - first));
+            ural::advance(s, middle - first);
+
+            ::ural::rotate_fn{}(std::move(s));
+        }
+
+        template <class ForwardCursor, class UnaryPredicate, class Buffer>
         ForwardCursor
-        impl(ForwardCursor in, UnaryPredicate pred) const
+        impl(ForwardCursor in, UnaryPredicate pred, Buffer & buffer) const
         {
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<ForwardCursor>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<UnaryPredicate, ForwardCursor>));
             BOOST_CONCEPT_ASSERT((concepts::Permutable<ForwardCursor>));
 
-            in.shrink_front();
-            in = find_if_not_fn{}(std::move(in), pred);
-
             if(!in)
             {
                 return in;
             }
 
             // Разделяем на месте
-            auto s = ural::shrink_front_copy(std::move(in));
-            auto r = this->impl_inplace(std::move(s), pred);
+            auto s = ural::shrink_front_copy(in);
+            auto r = this->impl_inplace(std::move(s), pred, buffer);
             auto const nt = ural::size(r.traversed_front());
             return ural::next(in, nt);
         }
@@ -1636,6 +2403,30 @@ namespace details
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Input, Output1>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Input, Output2>));
 
+            using Contiguous
+                = std::integral_constant<bool, details::use_contiguous_filter<Input, Output1>::value
+                                               && details::use_contiguous_filter<Input, Output2>::value>;
+
+            return partition_copy_fn::impl(std::move(in), std::move(out_true),
+                                           std::move(out_false), std::move(pred),
+                                           Contiguous{});
+        }
+
+        template <class Input, class Output1, class Output2, class UnaryPredicate>
+        static ural::tuple<Input, Output1, Output2>
+        impl(Input in, Output1 out_true, Output2 out_false, UnaryPredicate pred,
+             std::true_type)
+        {
+            return details::contiguous_partition_copy(std::move(in),
+                                                      std::move(out_true),
+                                                      std::move(out_false), pred);
+        }
+
+        template <class Input, class Output1, class Output2, class UnaryPredicate>
+        static ural::tuple<Input, Output1, Output2>
+        impl(Input in, Output1 out_true, Output2 out_false, UnaryPredicate pred,
+             std::false_type)
+        {
             auto out = ::ural::experimental::make_partition_cursor(std::move(out_true),
                                                                      std::move(out_false),
                                                                      std::move(pred));
@@ -27,16 +27,181 @@
  изменяющие порядок элементов существующих последовательностей.
 */
 
+#include <ural/sequence/adaptors/reversed.hpp>
+#include <ural/sequence/chunks.hpp>
 #include <ural/sequence/adaptors/zip.hpp>
 #include <ural/sequence/function_output.hpp>
 #include <ural/sequence/make.hpp>
 #include <ural/algorithm/core.hpp>
+#include <ural/algorithm/searchers.hpp>
 #include <ural/concepts.hpp>
+#include <ural/thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <vector>
 
 namespace ural
 {
 inline namespace v1
 {
+    /// @cond false
+    namespace details
+    {
+        template <class RACursor>
+        RACursor
+        random_access_subcursor(RACursor cur,
+                                difference_type_t<RACursor> first,
+                                difference_type_t<RACursor> last)
+        {
+            assert(0 <= first && first <= last && last <= cur.size());
+
+            cur += first;
+            cur.shrink_front();
+            cur.pop_back(cur.size() - (last - first));
+            cur.shrink_back();
+
+            return cur;
+        }
+
+        /** Последовательности, в которых меньше элементов, чем это значение,
+        умноженное на два, обрабатываются в одном потоке.
+        */
+        constexpr std::ptrdiff_t parallel_scan_grain = 1 << 15;
+
+        /** Количество элементов, после обработки которых поток проверяет, не
+        найден ли уже результат другим потоком.
+        */
+        constexpr std::ptrdiff_t parallel_scan_block = 1 << 12;
+
+        /* Разбиение последовательности на части одинаковой длины (кроме,
+        возможно, последней), количество которых не превосходит threads.
+        */
+        template <class RACursor>
+        ::ural::experimental::chunks_cursor<RACursor>
+        parallel_chunks(RACursor const & cur, std::size_t threads)
+        {
+            using Size = difference_type_t<RACursor>;
+
+            auto const n = cur.size();
+            auto const tasks = std::max(Size{1}, std::min(static_cast<Size>(threads),
+                                                          n / details::parallel_scan_grain));
+            auto const chunk = std::max(Size{1}, (n + tasks - 1) / tasks);
+
+            return ::ural::experimental::make_chunks_cursor(cur, chunk);
+        }
+
+        template <class Function>
+        void parallel_for_index(std::size_t first, std::size_t last,
+                                Function const & f)
+        {
+            assert(first < last);
+
+            if(last - first == 1)
+            {
+                f(first);
+                return;
+            }
+
+            auto const mid = first + (last - first) / 2;
+
+            ::ural::details::parallel_invoke(true,
+                [&]{ details::parallel_for_index(first, mid, f); },
+                [&]{ details::parallel_for_index(mid, last, f); });
+        }
+
+        /* Вызывает f(i, part) для каждой части в отдельном потоке. Части
+        передаются как курсоры того же типа, что и исходный, поэтому для них
+        действуют те же оптимизации, что и для всей последовательности.
+        */
+        template <class RACursor, class Function>
+        void parallel_for_chunks(::ural::experimental::chunks_cursor<RACursor> const & chunks,
+                                 Function const & f)
+        {
+            if(!chunks)
+            {
+                return;
+            }
+
+            if(chunks.size() == 1)
+            {
+                f(0, chunks.base());
+                return;
+            }
+
+            details::parallel_for_index(0, chunks.size(), [&](std::size_t i)
+            {
+                auto const part = chunks[i];
+                auto const & base = part.base();
+
+                f(i, details::random_access_subcursor(base, 0, std::min(part.count(), base.size())));
+            });
+        }
+
+        /* Сумма значений f(part) по всем частям. Частичные суммы
+        складываются в порядке следования частей.
+        */
+        template <class RACursor, class Function>
+        difference_type_t<RACursor>
+        parallel_sum_chunks(RACursor const & cur, std::size_t threads,
+                            Function const & f)
+        {
+            using Size = difference_type_t<RACursor>;
+
+            auto const chunks = details::parallel_chunks(cur, threads);
+
+            std::vector<Size> partial(chunks.size(), Size{0});
+
+            details::parallel_for_chunks(chunks, [&](std::size_t i, RACursor part)
+                                         { partial[i] = f(std::move(part)); });
+
+            Size result{0};
+
+            for(auto const & x : partial)
+            {
+                result += x;
+            }
+
+            return result;
+        }
+
+        /* Есть ли в последовательности элемент, удовлетворяющий pred. Поток
+        прекращает работу, как только такой элемент найден в любой части.
+        */
+        template <class RACursor, class Predicate>
+        bool parallel_find_any(RACursor const & cur, std::size_t threads,
+                               Predicate const & pred)
+        {
+            std::atomic<bool> found(false);
+
+            auto task = [&](std::size_t, RACursor part)
+            {
+                auto p = pred;
+
+                while(!!part && !found.load(std::memory_order_relaxed))
+                {
+                    auto const m = std::min<difference_type_t<RACursor>>
+                        (part.size(), details::parallel_scan_block);
+
+                    if(!!::ural::find_if_fn{}(details::random_access_subcursor(part, 0, m), p))
+                    {
+                        found.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    part += m;
+                }
+            };
+
+            details::parallel_for_chunks(details::parallel_chunks(cur, threads), task);
+
+            return found.load();
+        }
+    }
+    // namespace details
+    /// @endcond
+
     /** @ingroup NonModifyingSequenceOperations
     @brief Класс функционального объекта, проверяющего, что все элементы
     последовательности удовлетворяют предикату.
@@ -59,6 +224,30 @@ inline namespace v1
 
             return !find_if_not_fn{}(std::forward<Input>(in), std::move(pred));
         }
+
+        /** @brief Параллельная проверка того, что все элементы
+        последовательности удовлетворяют предикату
+        @details Последовательность делится на части, которые проверяются в
+        отдельных потоках. Все потоки прекращают работу, как только один из
+        них находит элемент, не удовлетворяющий предикату.
+        @param policy стратегия выполнения
+        @param in последовательность произвольного доступа
+        @param pred предикат, копия которого используется в каждом потоке
+        @return @b true, если для всех элементов @c x последовательности @c in
+        выполняется <tt> pred(x) != false </tt>
+        */
+        template <class RASequence, class UnaryPredicate>
+        bool operator()(parallel_execution_policy const & policy,
+                        RASequence && in, UnaryPredicate pred) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<UnaryPredicate, cursor_type_t<RASequence>>));
+
+            auto not_pred = ::ural::not_fn(::ural::make_callable(std::move(pred)));
+
+            return !details::parallel_find_any(::ural::cursor_fwd<RASequence>(in),
+                                               policy.threads(), not_pred);
+        }
     };
 
     /** @ingroup NonModifyingSequenceOperations
@@ -84,6 +273,29 @@ inline namespace v1
 
             return !find_if_fn{}(std::forward<Input>(in), std::move(pred));
         }
+
+        /** @brief Параллельная проверка того, что ни один элемент
+        последовательности не удовлетворяет предикату
+        @details Последовательность делится на части, которые проверяются в
+        отдельных потоках. Все потоки прекращают работу, как только один из
+        них находит элемент, удовлетворяющий предикату.
+        @param policy стратегия выполнения
+        @param in последовательность произвольного доступа
+        @param pred предикат, копия которого используется в каждом потоке
+        @return @b true, если ни для одного элемента @c x последовательности
+        @c in не выполняется <tt> pred(x) != false </tt>
+        */
+        template <class RASequence, class UnaryPredicate>
+        bool operator()(parallel_execution_policy const & policy,
+                        RASequence && in, UnaryPredicate pred) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<UnaryPredicate, cursor_type_t<RASequence>>));
+
+            return !details::parallel_find_any(::ural::cursor_fwd<RASequence>(in),
+                                               policy.threads(),
+                                               ::ural::make_callable(std::move(pred)));
+        }
     };
 
     /** @ingroup NonModifyingSequenceOperations
@@ -108,6 +320,21 @@ inline namespace v1
 
             return !none_of_fn{}(std::forward<Input>(in), std::move(pred));
         }
+
+        /** @brief Параллельная проверка того, что хотя бы один элемент
+        последовательности удовлетворяет предикату
+        @param policy стратегия выполнения
+        @param in последовательность произвольного доступа
+        @param pred предикат, копия которого используется в каждом потоке
+        @return @b true, если для хотя бы одного элемента @c x
+        последовательности @c in выполняется <tt> pred(x) != false </tt>
+        */
+        template <class RASequence, class UnaryPredicate>
+        bool operator()(parallel_execution_policy const & policy,
+                        RASequence && in, UnaryPredicate pred) const
+        {
+            return !none_of_fn{}(policy, std::forward<RASequence>(in), std::move(pred));
+        }
     };
 
     /** @ingroup NonModifyingSequenceOperations
@@ -163,6 +390,67 @@ inline namespace v1
                                     std::move(result)[ural::_2].argument());
         }
 
+        /** Последовательность делится на части, каждая из которых
+        обрабатывается в отдельном потоке своей копией @c f. Затем копии
+        объединяются слева направо в порядке следования частей:
+        <tt> reduce(acc, std::move(part)) </tt>, где @c acc --- копия,
+        обработавшая первую часть. Поэтому результат не зависит от
+        того, в каком порядке завершились потоки.
+        @brief Параллельное применение функционального объекта к каждому
+        элементу последовательности
+        @param policy стратегия выполнения
+        @param in последовательность произвольного доступа
+        @param f функциональный объект
+        @param reduce функция объединения состояний копий @c f
+        @return Кортеж, первый компонент которого получается продвижением
+        <tt> ::ural::cursor_fwd<RASequence>(in) </tt> до исчерпания, а второй
+        --- результат объединения копий @c f.
+        */
+        template <class RASequence, class UnaryFunction, class Reduce>
+        tuple<cursor_type_t<RASequence>, function_type_t<UnaryFunction>>
+        operator()(parallel_execution_policy const & policy,
+                   RASequence && in, UnaryFunction f, Reduce reduce) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectCallable<UnaryFunction, cursor_type_t<RASequence>>));
+
+            using Cursor = cursor_type_t<RASequence>;
+            using Function = function_type_t<UnaryFunction>;
+
+            auto cur = ::ural::cursor_fwd<RASequence>(in);
+            auto const chunks = details::parallel_chunks(cur, policy.threads());
+
+            auto const g = ::ural::make_callable(std::move(f));
+
+            std::vector<Function> parts(chunks.size(), g);
+
+            details::parallel_for_chunks(chunks, [&](std::size_t i, Cursor part)
+            {
+                auto & h = parts[i];
+
+                for(; !!part; ++ part)
+                {
+                    h(*part);
+                }
+            });
+
+            cur += cur.size();
+
+            if(parts.empty())
+            {
+                return tuple<Cursor, Function>(std::move(cur), g);
+            }
+
+            auto f_reduce = ::ural::make_callable(std::move(reduce));
+
+            for(auto i = parts.begin() + 1; i != parts.end(); ++ i)
+            {
+                f_reduce(parts.front(), std::move(*i));
+            }
+
+            return tuple<Cursor, Function>(std::move(cur), std::move(parts.front()));
+        }
+
     private:
         template <class Input, class UnaryFunction>
         static tuple<Input, UnaryFunction>
@@ -219,6 +507,101 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<BinaryPredicate, Input, Forward>));
 
+            using Value = value_type_t<Forward>;
+
+            using Contiguous = details::use_contiguous_find<Input, Value, BinaryPredicate>;
+
+            using Bytes = std::integral_constant<bool,
+                details::is_byte_like<value_type_t<Input>>::value
+                && std::is_integral<Value>::value
+                && std::is_same<BinaryPredicate, ::ural::equal_to<>>::value>;
+
+            return find_first_of_fn::impl(std::move(in), std::move(s),
+                                          std::move(bin_pred),
+                                          Contiguous{}, Bytes{});
+        }
+
+        /* Если искомых значений немного, то они сравниваются с элементами
+        одновременно, иначе однобайтовые элементы проверяются по таблице.
+        */
+        template <class Input, class Forward, class BinaryPredicate, class Bytes>
+        static Input impl(Input in, Forward s, BinaryPredicate bin_pred,
+                          std::true_type, Bytes)
+        {
+            using Value = value_type_t<Input>;
+
+            Value values[details::find_any_max_values];
+            std::size_t k = 0;
+
+            for(auto r = s; !!r; ++ r)
+            {
+                Value x;
+
+                if(!details::narrow_value(*r, x)
+                   || std::find(values, values + k, x) != values + k)
+                {
+                    continue;
+                }
+
+                if(k == details::find_any_max_values)
+                {
+                    return find_first_of_fn::impl(std::move(in), std::move(s),
+                                                  std::move(bin_pred),
+                                                  std::false_type{}, Bytes{});
+                }
+
+                values[k] = x;
+                ++ k;
+            }
+
+            auto const n = in.size();
+
+            if(k == 0)
+            {
+                in += n;
+                return in;
+            }
+
+            std::fill(values + k, values + details::find_any_max_values, values[0]);
+
+            auto const first = details::contiguous_data(in);
+            auto const pos = details::find_any_value<Value>(first, first + n, values);
+
+            in += (pos - first);
+
+            return in;
+        }
+
+        template <class Input, class Forward, class BinaryPredicate>
+        static Input impl(Input in, Forward s, BinaryPredicate,
+                          std::false_type, std::true_type)
+        {
+            details::byte_set set;
+
+            for(; !!s; ++ s)
+            {
+                value_type_t<Input> x;
+
+                if(details::narrow_value(*s, x))
+                {
+                    set.set(static_cast<unsigned char>(x));
+                }
+            }
+
+            for(; !!in; ++ in)
+            {
+                if(set.test(static_cast<unsigned char>(*in)))
+                {
+                    return in;
+                }
+            }
+            return in;
+        }
+
+        template <class Input, class Forward, class BinaryPredicate>
+        static Input impl(Input in, Forward s, BinaryPredicate bin_pred,
+                          std::false_type, std::false_type)
+        {
             for(; !!in; ++ in)
             {
                 auto r = find_fn{}(s, *in, bin_pred);
@@ -320,6 +703,21 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<BinaryPredicate, Forward>));
 
+            using Contiguous = details::use_contiguous_adjacent_find<Forward, BinaryPredicate>;
+
+            return adjacent_find_fn::impl(std::move(s), std::move(bin_pred), Contiguous{});
+        }
+
+        template <class Forward, class BinaryPredicate>
+        static Forward impl(Forward s, BinaryPredicate, std::true_type)
+        {
+            return details::contiguous_adjacent_find(std::move(s),
+                                                     details::elementwise_equal{});
+        }
+
+        template <class Forward, class BinaryPredicate>
+        static Forward impl(Forward s, BinaryPredicate bin_pred, std::false_type)
+        {
             if(!s)
             {
                 return s;
@@ -384,6 +782,33 @@ inline namespace v1
             return this->impl(::ural::cursor_fwd<Input>(in),
                               ::ural::make_callable(std::move(pred)));
         }
+
+        /** @brief Параллельный подсчёт количества элементов
+        последовательности, удовлетворяющих предикату
+        @details Последовательность делится на части, элементы которых
+        подсчитываются в отдельных потоках, затем результаты складываются.
+        @param policy стратегия выполнения
+        @param in последовательность произвольного доступа
+        @param pred предикат, копия которого используется в каждом потоке
+        @return Количество элементов @c x последовательности @c in, таких, что
+        <tt> pred(x) != false </tt>.
+        */
+        template <class RASequence, class UnaryPredicate>
+        auto operator()(parallel_execution_policy const & policy,
+                        RASequence && in, UnaryPredicate pred) const
+        -> difference_type_t<cursor_type_t<RASequence>>
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<UnaryPredicate,
+                                                              cursor_type_t<RASequence>>));
+
+            auto const f_pred = ::ural::make_callable(std::move(pred));
+
+            return details::parallel_sum_chunks(::ural::cursor_fwd<RASequence>(in),
+                                                policy.threads(),
+                                                [&f_pred](auto part)
+                                                { return count_if_fn::impl(part, f_pred); });
+        }
     };
 
     /** @ingroup NonModifyingSequenceOperations
@@ -400,6 +825,23 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<BinaryPredicate, Input, T const *>));
 
+            using Contiguous = details::use_contiguous_find<Input, T, BinaryPredicate>;
+
+            return count_fn::impl(std::move(in), value, std::move(pred),
+                                  Contiguous{});
+        }
+
+        template <class Input, class T, class BinaryPredicate>
+        static difference_type_t<Input>
+        impl(Input in, T const & value, BinaryPredicate, std::true_type)
+        {
+            return details::contiguous_count(in, value);
+        }
+
+        template <class Input, class T, class BinaryPredicate>
+        static difference_type_t<Input>
+        impl(Input in, T const & value, BinaryPredicate pred, std::false_type)
+        {
             return count_if_fn{}(std::move(in), [&](auto const & x) { return pred(x, value); });
         }
 
@@ -426,6 +868,37 @@ inline namespace v1
             return this->impl(::ural::cursor_fwd<Input>(in), value,
                               ::ural::make_callable(std::move(pred)));
         }
+
+        /** @brief Параллельный подсчёт количества элементов
+        последовательности, эквивалентных заданному значению
+        @details Последовательность делится на части, элементы которых
+        подсчитываются в отдельных потоках, затем результаты складываются.
+        @param policy стратегия выполнения
+        @param in последовательность произвольного доступа
+        @param value значение
+        @param pred бинарный предикат, определяющий эквивалентность элементов
+        @return Количество элементов @c x последовательности @c in, таких, что
+        <tt> pred(x, value) == true </tt>.
+        */
+        template <class RASequence, class T,
+                  class BinaryPredicate = ::ural::equal_to<>>
+        auto operator()(parallel_execution_policy const & policy,
+                        RASequence && in, T const & value,
+                        BinaryPredicate pred = BinaryPredicate()) const
+        -> difference_type_t<cursor_type_t<RASequence>>
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectPredicate<BinaryPredicate,
+                                                             cursor_type_t<RASequence>,
+                                                             T const *>));
+
+            auto const f_pred = ::ural::make_callable(std::move(pred));
+
+            return details::parallel_sum_chunks(::ural::cursor_fwd<RASequence>(in),
+                                                policy.threads(),
+                                                [&](auto part)
+                                                { return count_fn::impl(part, value, f_pred); });
+        }
     };
 
     /** @ingroup NonModifyingSequenceOperations
@@ -472,6 +945,23 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input2>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<BinaryPredicate, Input1, Input2>));
 
+            using Contiguous = details::use_contiguous_mismatch<Input1, Input2, BinaryPredicate>;
+
+            return mismatch_fn::impl(std::move(in1), std::move(in2),
+                                     std::move(pred), Contiguous{});
+        }
+
+        template <class Input1, class Input2, class BinaryPredicate>
+        static tuple<Input1, Input2>
+        impl(Input1 in1, Input2 in2, BinaryPredicate, std::true_type)
+        {
+            return details::contiguous_mismatch(std::move(in1), std::move(in2));
+        }
+
+        template <class Input1, class Input2, class BinaryPredicate>
+        static tuple<Input1, Input2>
+        impl(Input1 in1, Input2 in2, BinaryPredicate pred, std::false_type)
+        {
             typedef tuple<Input1, Input2> Tuple;
             for(; !!in1 && !!in2; ++ in1, (void) ++ in2)
             {
@@ -522,81 +1012,24 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input2>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectlyComparable<Input1, Input2, BinaryPredicate>));
 
-            auto const r = ural::mismatch_fn{}(std::move(in1), std::move(in2),
-                                               std::move(pred));
-            return !r[ural::_1] && !r[ural::_2];
+            using Contiguous = details::use_contiguous_mismatch<Input1, Input2, BinaryPredicate>;
+
+            return equal_fn::impl(std::move(in1), std::move(in2),
+                                  std::move(pred), Contiguous{});
         }
-    };
 
-    /** @ingroup NonModifyingSequenceOperations
-    @brief Функциональный объект для проверки того, что одна последовательность
-    является перестановкой другой
-    */
-    class is_permutation_fn
-    {
-    public:
-        /** @brief Проверка того, что одна последовательность являются
-        перестановкой другой.
-        @param s1, s2 прямые последовательности
-        @param pred бинарный предикат
-        @return @b true, если для каждого элемента @c s1 существует эквивалентый
-        в смысле @c pred элемент @c s2.
-        */
-        template <class Forward1, class Forward2,
-                  class BinaryPredicate = ::ural::equal_to<>>
-        bool operator()(Forward1 && s1, Forward2 && s2,
-                        BinaryPredicate pred = BinaryPredicate()) const
+        template <class Input1, class Input2, class BinaryPredicate>
+        static bool impl(Input1 in1, Input2 in2, BinaryPredicate, std::true_type)
         {
-            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward1>));
-            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward2>));
-            BOOST_CONCEPT_ASSERT((concepts::IndirectlyComparable<cursor_type_t<Forward1>,
-                                                                 cursor_type_t<Forward2>,
-                                                                 BinaryPredicate>));
-
-            return this->impl(::ural::cursor_fwd<Forward1>(s1),
-                              ::ural::cursor_fwd<Forward2>(s2),
-                              ::ural::make_callable(std::move(pred)));
+            return details::contiguous_equal(in1, in2);
         }
 
-    private:
-        template <class Forward1, class Forward2, class BinaryPredicate>
-        static bool
-        impl(Forward1 s1, Forward2 s2, BinaryPredicate pred)
+        template <class Input1, class Input2, class BinaryPredicate>
+        static bool impl(Input1 in1, Input2 in2, BinaryPredicate pred, std::false_type)
         {
-            BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward1>));
-            BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward2>));
-            BOOST_CONCEPT_ASSERT((concepts::IndirectlyComparable<Forward1, Forward2, BinaryPredicate>));
-
-            std::tie(s1, s2) = ural::mismatch_fn{}(std::move(s1), std::move(s2),
-                                                   pred);
-
-            s1.shrink_front();
-            s2.shrink_front();
-
-            if(ural::size(s1) != ural::size(s2))
-            {
-                return false;
-            }
-
-            for(; !!s1; ++ s1)
-            {
-                // Пропускаем элементы, которые уже встречались
-                if(!!find_fn{}(s1.traversed_front(), *s1, pred))
-                {
-                    continue;
-                }
-
-                auto s = s1;
-                ++ s;
-                auto const n1 = 1 + count_fn{}(s, *s1, pred);
-                auto const n2 = count_fn{}(s2, *s1, pred);
-
-                if(n1 != n2)
-                {
-                    return false;
-                }
-            }
-            return true;
+            auto const r = ural::mismatch_fn{}(std::move(in1), std::move(in2),
+                                               std::move(pred));
+            return !r[ural::_1] && !r[ural::_2];
         }
     };
 
@@ -606,7 +1039,12 @@ inline namespace v1
     class search_fn
     {
     public:
-        /** @brief Поиск подпоследовательности
+        /** Если обе последовательности являются конечными последовательностями
+        произвольного доступа однобайтовых элементов, а @c bin_pred --- это
+        <tt> equal_to<> </tt>, то используется алгоритм
+        Бойера-Мура-Хорспула, который в среднем просматривает лишь часть
+        элементов @c in.
+        @brief Поиск подпоследовательности
         @param in последовательность
         @param s искомая подпоследовательность
         @param bin_pred бинарный предикат
@@ -615,7 +1053,8 @@ inline namespace v1
         непройденной части.
         */
         template <class Forward1, class Forward2,
-                  class BinaryPredicate = ::ural::equal_to<>>
+                  class BinaryPredicate = ::ural::equal_to<>,
+                  class = cursor_type_t<Forward2>>
         cursor_type_t<Forward1>
         operator()(Forward1 && in, Forward2 && s,
                    BinaryPredicate bin_pred = BinaryPredicate()) const
@@ -631,9 +1070,58 @@ inline namespace v1
                               ::ural::make_callable(std::move(bin_pred)));
         }
 
+        /** @brief Поиск подпоследовательности с помощью объекта, заранее
+        обработавшего образец, например, @c boyer_moore_searcher,
+        @c boyer_moore_horspool_searcher или @c two_way_searcher.
+        @param in последовательность
+        @param searcher объект поиска
+        @return <tt> searcher(::ural::cursor_fwd<Forward>(in)) </tt>
+        */
+        template <class Forward, class Searcher>
+        auto operator()(Forward && in, Searcher const & searcher) const
+        -> decltype(searcher(::ural::cursor_fwd<Forward>(in)))
+        {
+            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward>));
+
+            return searcher(::ural::cursor_fwd<Forward>(in));
+        }
+
     private:
-        template<class Forward1, class Forward2, class BinaryPredicate>
+        template <class Forward1, class Forward2, class BinaryPredicate>
         static Forward1 impl(Forward1 in, Forward2 s, BinaryPredicate p)
+        {
+            using Tag1 = decltype(::ural::make_cursor_tag(in));
+            using Tag2 = decltype(::ural::make_cursor_tag(s));
+
+            using Skip = std::integral_constant<bool,
+                std::is_convertible<Tag1, finite_random_access_cursor_tag>::value
+                && std::is_convertible<Tag2, finite_random_access_cursor_tag>::value
+                && details::use_byte_skip_table<value_type_t<Forward2>,
+                                                std::hash<value_type_t<Forward2>>,
+                                                BinaryPredicate>::value
+                && details::is_byte_like<value_type_t<Forward1>>::value>;
+
+            return search_fn::impl(std::move(in), std::move(s), std::move(p),
+                                   Skip{});
+        }
+
+        template <class RACursor1, class RACursor2, class BinaryPredicate>
+        static RACursor1 impl(RACursor1 in, RACursor2 s, BinaryPredicate p,
+                              std::true_type)
+        {
+            // Для коротких образцов предварительная обработка не окупается
+            if(s.size() < 2)
+            {
+                return search_fn::impl(std::move(in), std::move(s), std::move(p),
+                                       std::false_type{});
+            }
+
+            return boyer_moore_horspool_searcher<RACursor2>(std::move(s))(std::move(in));
+        }
+
+        template<class Forward1, class Forward2, class BinaryPredicate>
+        static Forward1 impl(Forward1 in, Forward2 s, BinaryPredicate p,
+                             std::false_type)
         {
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward1>));
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward2>));
@@ -713,6 +1201,84 @@ inline namespace v1
                 return in;
             }
 
+            return search_n_fn::impl(std::move(in), n, value, std::move(bin_pred),
+                                     ::ural::make_cursor_tag(in));
+        }
+
+        /* Проверяется последний элемент окна длины n: если он не подходит,
+        то ни одно окно, содержащее его, не подходит, и поиск продолжается со
+        следующего за ним элемента. Иначе подходящие элементы просматриваются
+        от него назад, а затем, если нужно, вперёд. Каждый элемент
+        проверяется не более одного раза, а при коротких сериях большинство
+        элементов не проверяется вовсе.
+        */
+        template <class RandomAccess, class T,  class BinaryPredicate>
+        static RandomAccess impl(RandomAccess in,
+                                 difference_type_t<RandomAccess> const n,
+                                 T const & value,
+                                 BinaryPredicate bin_pred,
+                                 finite_random_access_cursor_tag)
+        {
+            using Difference = difference_type_t<RandomAccess>;
+
+            Difference const size = in.size();
+
+            for(Difference first = 0; n > 0 && size - first >= n;)
+            {
+                auto const last = first + n - 1;
+
+                if(!bin_pred(in[last], value))
+                {
+                    first = last + 1;
+                    continue;
+                }
+
+                auto candidate = last;
+
+                for(; candidate != first && bin_pred(in[candidate - 1], value);)
+                {
+                    -- candidate;
+                }
+
+                if(candidate != first)
+                {
+                    // [candidate; last] подходят, проверяем продолжение
+                    auto const stop = candidate + n;
+
+                    if(stop > size)
+                    {
+                        break;
+                    }
+
+                    auto pos = last + 1;
+
+                    for(; pos != stop && bin_pred(in[pos], value);)
+                    {
+                        ++ pos;
+                    }
+
+                    if(pos != stop)
+                    {
+                        first = pos + 1;
+                        continue;
+                    }
+                }
+
+                in += candidate;
+                return in;
+            }
+
+            in += size;
+            return in;
+        }
+
+        template <class Forward, class T,  class BinaryPredicate>
+        static Forward impl(Forward in,
+                            difference_type_t<Forward> const n,
+                            T const & value,
+                            BinaryPredicate bin_pred,
+                            forward_cursor_tag)
+        {
             for(; !!in; ++ in)
             {
                 if(!bin_pred(*in, value))
@@ -783,6 +1349,53 @@ inline namespace v1
         template <class Forward1, class Forward2, class BinaryPredicate>
         static Forward1
         impl(Forward1 in, Forward2 s, BinaryPredicate bin_pred)
+        {
+            using Tag1 = decltype(::ural::make_cursor_tag(in));
+            using Tag2 = decltype(::ural::make_cursor_tag(s));
+
+            using Backward = std::integral_constant<bool,
+                std::is_convertible<Tag1, finite_random_access_cursor_tag>::value
+                && std::is_convertible<Tag2, finite_random_access_cursor_tag>::value>;
+
+            return find_end_fn::impl(std::move(in), std::move(s),
+                                     std::move(bin_pred), Backward{});
+        }
+
+        /* Последнее вхождение --- это первое вхождение обращённого образца в
+        обращённую последовательность, поэтому поиск можно прекратить, как
+        только оно найдено, и использовать алгоритмы с пропуском элементов.
+        */
+        template <class RACursor1, class RACursor2, class BinaryPredicate>
+        static RACursor1
+        impl(RACursor1 in, RACursor2 s, BinaryPredicate bin_pred, std::true_type)
+        {
+            auto const n = in.size();
+            auto const m = s.size();
+
+            if(m == 0)
+            {
+                return in;
+            }
+
+            auto r = ::ural::search_fn{}(::ural::experimental::make_reverse_cursor(in),
+                                         ::ural::experimental::make_reverse_cursor(s),
+                                         std::move(bin_pred));
+
+            if(!r)
+            {
+                in += n;
+            }
+            else
+            {
+                in += r.size() - m;
+            }
+
+            return in;
+        }
+
+        template <class Forward1, class Forward2, class BinaryPredicate>
+        static Forward1
+        impl(Forward1 in, Forward2 s, BinaryPredicate bin_pred, std::false_type)
         {
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward1>));
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward2>));
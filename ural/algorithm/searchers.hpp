@@ -0,0 +1,606 @@
+#ifndef Z_URAL_ALGORITHM_SEARCHERS_HPP_INCLUDED
+#define Z_URAL_ALGORITHM_SEARCHERS_HPP_INCLUDED
+
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/** @file ural/algorithm/searchers.hpp
+ @brief Объекты для поиска подпоследовательности в последовательностях
+ произвольного доступа, предварительно обрабатывающие образец: алгоритмы
+ Бойера-Мура, Бойера-Мура-Хорспула и двусторонний алгоритм Крошмора-Перрена.
+ Используются вместе с @c search_fn: <tt> ural::search(in, searcher) </tt>.
+*/
+
+#include <ural/algorithm/contiguous.hpp>
+#include <ural/functional/cpp_operators.hpp>
+#include <ural/functional/make_callable.hpp>
+#include <ural/sequence/make.hpp>
+#include <ural/concepts.hpp>
+
+#include <array>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace ural
+{
+inline namespace v1
+{
+    /// @cond false
+    namespace details
+    {
+        /* Для однобайтовых значений, сравниваемых оператором "равно", таблица
+        сдвигов хранится в виде массива, иначе --- в виде хэш-таблицы.
+        */
+        template <class T, class Hash, class BinaryPredicate>
+        struct use_byte_skip_table
+         : std::integral_constant<bool, is_byte_like<T>::value
+                                        && std::is_same<Hash, std::hash<T>>::value
+                                        && std::is_same<BinaryPredicate, ::ural::equal_to<>>::value>
+        {};
+
+        template <class T, class Difference, class Hash, class BinaryPredicate,
+                  bool = use_byte_skip_table<T, Hash, BinaryPredicate>::value>
+        class skip_table
+        {
+        public:
+            skip_table(Difference default_value, Hash hf, BinaryPredicate pred)
+             : default_(default_value)
+             , table_(0, std::move(hf), std::move(pred))
+            {}
+
+            void set(T const & key, Difference value)
+            {
+                table_[key] = value;
+            }
+
+            template <class U>
+            Difference operator[](U const & key) const
+            {
+                auto pos = table_.find(key);
+
+                return pos == table_.end() ? default_ : pos->second;
+            }
+
+        private:
+            Difference default_;
+            std::unordered_map<T, Difference, Hash, BinaryPredicate> table_;
+        };
+
+        template <class T, class Difference, class Hash, class BinaryPredicate>
+        class skip_table<T, Difference, Hash, BinaryPredicate, true>
+        {
+        public:
+            skip_table(Difference default_value, Hash, BinaryPredicate)
+            {
+                table_.fill(default_value);
+            }
+
+            void set(T const & key, Difference value)
+            {
+                table_[static_cast<unsigned char>(key)] = value;
+            }
+
+            template <class U>
+            Difference operator[](U const & key) const
+            {
+                return table_[static_cast<unsigned char>(key)];
+            }
+
+        private:
+            std::array<Difference, UCHAR_MAX + 1> table_;
+        };
+
+        /* Таблица "плохого символа": расстояние от последнего вхождения
+        элемента в образец (не считая последнего элемента) до конца образца.
+        */
+        template <class Table, class RACursor>
+        void fill_bad_character_table(Table & table, RACursor const & pattern)
+        {
+            auto const m = pattern.size();
+
+            for(auto i = 0*m; i + 1 < m; ++ i)
+            {
+                table.set(pattern[i], m - 1 - i);
+            }
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    /** Для каждого положения образца проверяется последний элемент окна, и
+    окно сдвигается в соответствии с последним вхождением этого элемента в
+    образец. В среднем просматривается лишь часть элементов
+    последовательности, но в худшем случае требуется <tt> O(n*m) </tt>
+    сравнений.
+    @brief Поиск подпоследовательности по алгоритму Бойера-Мура-Хорспула
+    @tparam RACursor тип курсора образца
+    @tparam Hash тип хэш-функции элементов образца
+    @tparam BinaryPredicate тип функции, определяющей равенство элементов,
+    должна быть согласована с @c Hash
+    */
+    template <class RACursor,
+              class Hash = std::hash<value_type_t<RACursor>>,
+              class BinaryPredicate = ::ural::equal_to<>>
+    class boyer_moore_horspool_searcher
+    {
+        BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+
+        using Difference = difference_type_t<RACursor>;
+        using Table = details::skip_table<value_type_t<RACursor>, Difference,
+                                          Hash, BinaryPredicate>;
+
+    public:
+        /** @brief Конструктор
+        @param pattern курсор образца
+        @param hf хэш-функция
+        @param pred функция, определяющая равенство элементов
+        */
+        explicit boyer_moore_horspool_searcher(RACursor pattern,
+                                               Hash hf = Hash(),
+                                               BinaryPredicate pred = BinaryPredicate())
+         : pattern_(std::move(pattern))
+         , pred_(pred)
+         , table_(pattern_.size(), std::move(hf), std::move(pred))
+        {
+            details::fill_bad_character_table(table_, pattern_);
+        }
+
+        /** @brief Поиск образца
+        @param in курсор последовательности, в которой производится поиск
+        @return Курсор, полученный из @c in продвижением до первого вхождения
+        образца, или до исчерпания, если образец не найден.
+        */
+        template <class RACursor2>
+        RACursor2 operator()(RACursor2 in) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor2>));
+
+            auto const n = static_cast<Difference>(in.size());
+            auto const m = static_cast<Difference>(pattern_.size());
+
+            if(m == 0)
+            {
+                return in;
+            }
+
+            for(auto j = 0*n; j + m <= n;)
+            {
+                auto const & last = in[j + m - 1];
+
+                if(pred_(last, pattern_[m - 1]))
+                {
+                    auto i = 0*m;
+                    for(; i + 1 < m && pred_(in[j + i], pattern_[i]); ++ i)
+                    {}
+
+                    if(i + 1 >= m)
+                    {
+                        in += j;
+                        return in;
+                    }
+                }
+
+                j += table_[last];
+            }
+
+            in += n;
+            return in;
+        }
+
+    private:
+        RACursor pattern_;
+        BinaryPredicate pred_;
+        Table table_;
+    };
+
+    /** Сравнение окна с образцом ведётся справа налево. При несовпадении
+    окно сдвигается на наибольшее из расстояний, заданных правилами
+    "плохого символа" и "хорошего суффикса".
+    @brief Поиск подпоследовательности по алгоритму Бойера-Мура
+    @tparam RACursor тип курсора образца
+    @tparam Hash тип хэш-функции элементов образца
+    @tparam BinaryPredicate тип функции, определяющей равенство элементов,
+    должна быть согласована с @c Hash
+    */
+    template <class RACursor,
+              class Hash = std::hash<value_type_t<RACursor>>,
+              class BinaryPredicate = ::ural::equal_to<>>
+    class boyer_moore_searcher
+    {
+        BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+
+        using Difference = difference_type_t<RACursor>;
+        using Table = details::skip_table<value_type_t<RACursor>, Difference,
+                                          Hash, BinaryPredicate>;
+
+    public:
+        /** @brief Конструктор
+        @param pattern курсор образца
+        @param hf хэш-функция
+        @param pred функция, определяющая равенство элементов
+        */
+        explicit boyer_moore_searcher(RACursor pattern,
+                                      Hash hf = Hash(),
+                                      BinaryPredicate pred = BinaryPredicate())
+         : pattern_(std::move(pattern))
+         , pred_(pred)
+         , table_(pattern_.size(), std::move(hf), std::move(pred))
+         , good_suffix_(pattern_.size())
+        {
+            details::fill_bad_character_table(table_, pattern_);
+            this->fill_good_suffix_table();
+        }
+
+        /** @brief Поиск образца
+        @param in курсор последовательности, в которой производится поиск
+        @return Курсор, полученный из @c in продвижением до первого вхождения
+        образца, или до исчерпания, если образец не найден.
+        */
+        template <class RACursor2>
+        RACursor2 operator()(RACursor2 in) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor2>));
+
+            auto const n = static_cast<Difference>(in.size());
+            auto const m = static_cast<Difference>(pattern_.size());
+
+            if(m == 0)
+            {
+                return in;
+            }
+
+            for(auto j = 0*n; j + m <= n;)
+            {
+                auto i = m - 1;
+                for(; i >= 0 && pred_(in[i + j], pattern_[i]); -- i)
+                {}
+
+                if(i < 0)
+                {
+                    in += j;
+                    return in;
+                }
+
+                auto const bad_character = table_[in[i + j]] - m + 1 + i;
+
+                j += std::max(good_suffix_[i], bad_character);
+            }
+
+            in += n;
+            return in;
+        }
+
+    private:
+        void fill_good_suffix_table()
+        {
+            auto const m = static_cast<Difference>(pattern_.size());
+
+            if(m == 0)
+            {
+                return;
+            }
+
+            // suffix[i] --- длина наибольшего общего суффикса образца и
+            // его префикса длины i + 1
+            std::vector<Difference> suffix(m);
+            suffix[m - 1] = m;
+
+            auto g = m - 1;
+            auto f = 0*m;
+
+            for(auto i = m - 2; i >= 0; -- i)
+            {
+                if(i > g && suffix[i + m - 1 - f] < i - g)
+                {
+                    suffix[i] = suffix[i + m - 1 - f];
+                }
+                else
+                {
+                    if(i < g)
+                    {
+                        g = i;
+                    }
+
+                    f = i;
+
+                    for(; g >= 0 && pred_(pattern_[g], pattern_[g + m - 1 - f]); -- g)
+                    {}
+
+                    suffix[i] = f - g;
+                }
+            }
+
+            std::fill(good_suffix_.begin(), good_suffix_.end(), m);
+
+            auto j = 0*m;
+            for(auto i = m - 1; i >= 0; -- i)
+            {
+                if(suffix[i] == i + 1)
+                {
+                    for(; j < m - 1 - i; ++ j)
+                    {
+                        if(good_suffix_[j] == m)
+                        {
+                            good_suffix_[j] = m - 1 - i;
+                        }
+                    }
+                }
+            }
+
+            for(auto i = 0*m; i + 2 <= m; ++ i)
+            {
+                good_suffix_[m - 1 - suffix[i]] = m - 1 - i;
+            }
+        }
+
+    private:
+        RACursor pattern_;
+        BinaryPredicate pred_;
+        Table table_;
+        std::vector<Difference> good_suffix_;
+    };
+
+    /** Образец разбивается в критической позиции на две части: правая часть
+    сравнивается слева направо, левая --- справа налево, а сдвиги
+    определяются периодом образца. Алгоритм выполняет не более <tt> 2*n </tt>
+    сравнений и использует дополнительную память, не зависящую от длины
+    образца.
+    @brief Поиск подпоследовательности по двустороннему алгоритму
+    Крошмора-Перрена
+    @tparam RACursor тип курсора образца
+    @tparam BinaryPredicate тип функции, определяющей равенство элементов
+    @tparam Compare тип функции сравнения элементов образца, используемой
+    для разбиения образца, отношение эквивалентности, порождаемое этой
+    функцией, должно совпадать с @c BinaryPredicate
+    */
+    template <class RACursor,
+              class BinaryPredicate = ::ural::equal_to<>,
+              class Compare = ::ural::less<>>
+    class two_way_searcher
+    {
+        BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+
+        using Difference = difference_type_t<RACursor>;
+
+    public:
+        /** @brief Конструктор
+        @param pattern курсор образца
+        @param pred функция, определяющая равенство элементов
+        @param cmp функция сравнения элементов
+        */
+        explicit two_way_searcher(RACursor pattern,
+                                  BinaryPredicate pred = BinaryPredicate(),
+                                  Compare cmp = Compare())
+         : pattern_(std::move(pattern))
+         , pred_(std::move(pred))
+         , critical_(-1)
+         , period_(1)
+         , periodic_(false)
+        {
+            auto const m = static_cast<Difference>(pattern_.size());
+
+            if(m == 0)
+            {
+                return;
+            }
+
+            Difference p1 = 1;
+            Difference p2 = 1;
+            auto const s1 = this->maximal_suffix(p1, [&](auto const & x, auto const & y)
+                                                 { return cmp(x, y); });
+            auto const s2 = this->maximal_suffix(p2, [&](auto const & x, auto const & y)
+                                                 { return cmp(y, x); });
+
+            critical_ = s1 > s2 ? s1 : s2;
+            period_ = s1 > s2 ? p1 : p2;
+
+            // Проверка того, что левая часть разбиения входит в правую с
+            // периодом period_
+            periodic_ = true;
+            for(auto i = 0*m; i <= critical_; ++ i)
+            {
+                if(!pred_(pattern_[i], pattern_[i + period_]))
+                {
+                    periodic_ = false;
+                    break;
+                }
+            }
+
+            if(!periodic_)
+            {
+                period_ = std::max(critical_ + 1, m - critical_ - 1) + 1;
+            }
+        }
+
+        /** @brief Поиск образца
+        @param in курсор последовательности, в которой производится поиск
+        @return Курсор, полученный из @c in продвижением до первого вхождения
+        образца, или до исчерпания, если образец не найден.
+        */
+        template <class RACursor2>
+        RACursor2 operator()(RACursor2 in) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor2>));
+
+            auto const n = static_cast<Difference>(in.size());
+            auto const m = static_cast<Difference>(pattern_.size());
+
+            if(m == 0)
+            {
+                return in;
+            }
+
+            // Длина префикса образца, совпадение которого уже известно
+            auto memory = Difference{-1};
+
+            for(auto j = 0*n; j + m <= n;)
+            {
+                auto i = std::max(critical_, memory) + 1;
+
+                for(; i < m && pred_(in[i + j], pattern_[i]); ++ i)
+                {}
+
+                if(i < m)
+                {
+                    j += i - critical_;
+                    memory = -1;
+                    continue;
+                }
+
+                for(i = critical_; i > memory && pred_(in[i + j], pattern_[i]); -- i)
+                {}
+
+                if(i <= memory)
+                {
+                    in += j;
+                    return in;
+                }
+
+                j += period_;
+
+                if(periodic_)
+                {
+                    memory = m - period_ - 1;
+                }
+            }
+
+            in += n;
+            return in;
+        }
+
+    private:
+        /* Начало (минус один) максимального в смысле less суффикса образца и
+        период этого суффикса
+        */
+        template <class Less>
+        Difference maximal_suffix(Difference & period, Less less) const
+        {
+            auto const m = static_cast<Difference>(pattern_.size());
+
+            auto ms = Difference{-1};
+            auto j = Difference{0};
+            auto k = Difference{1};
+            period = 1;
+
+            while(j + k < m)
+            {
+                auto const & a = pattern_[j + k];
+                auto const & b = pattern_[ms + k];
+
+                if(less(a, b))
+                {
+                    j += k;
+                    k = 1;
+                    period = j - ms;
+                }
+                else if(!less(b, a))
+                {
+                    if(k != period)
+                    {
+                        ++ k;
+                    }
+                    else
+                    {
+                        j += period;
+                        k = 1;
+                    }
+                }
+                else
+                {
+                    ms = j;
+                    j = ms + 1;
+                    k = period = 1;
+                }
+            }
+
+            return ms;
+        }
+
+    private:
+        RACursor pattern_;
+        BinaryPredicate pred_;
+        Difference critical_;
+        Difference period_;
+        bool periodic_;
+    };
+
+    /** @brief Создание объекта для поиска по алгоритму Бойера-Мура-Хорспула
+    @param pattern образец
+    @param hf хэш-функция
+    @param pred функция, определяющая равенство элементов
+    */
+    template <class RASequence,
+              class Hash = std::hash<value_type_t<cursor_type_t<RASequence>>>,
+              class BinaryPredicate = ::ural::equal_to<>>
+    boyer_moore_horspool_searcher<cursor_type_t<RASequence>, Hash,
+                                  function_type_t<BinaryPredicate>>
+    make_boyer_moore_horspool_searcher(RASequence && pattern, Hash hf = Hash(),
+                                       BinaryPredicate pred = BinaryPredicate())
+    {
+        using Result = boyer_moore_horspool_searcher<cursor_type_t<RASequence>, Hash,
+                                                     function_type_t<BinaryPredicate>>;
+        return Result(::ural::cursor_fwd<RASequence>(pattern), std::move(hf),
+                      ::ural::make_callable(std::move(pred)));
+    }
+
+    /** @brief Создание объекта для поиска по алгоритму Бойера-Мура
+    @param pattern образец
+    @param hf хэш-функция
+    @param pred функция, определяющая равенство элементов
+    */
+    template <class RASequence,
+              class Hash = std::hash<value_type_t<cursor_type_t<RASequence>>>,
+              class BinaryPredicate = ::ural::equal_to<>>
+    boyer_moore_searcher<cursor_type_t<RASequence>, Hash,
+                         function_type_t<BinaryPredicate>>
+    make_boyer_moore_searcher(RASequence && pattern, Hash hf = Hash(),
+                              BinaryPredicate pred = BinaryPredicate())
+    {
+        using Result = boyer_moore_searcher<cursor_type_t<RASequence>, Hash,
+                                            function_type_t<BinaryPredicate>>;
+        return Result(::ural::cursor_fwd<RASequence>(pattern), std::move(hf),
+                      ::ural::make_callable(std::move(pred)));
+    }
+
+    /** @brief Создание объекта для поиска по двустороннему алгоритму
+    @param pattern образец
+    @param pred функция, определяющая равенство элементов
+    @param cmp функция сравнения элементов
+    */
+    template <class RASequence,
+              class BinaryPredicate = ::ural::equal_to<>,
+              class Compare = ::ural::less<>>
+    two_way_searcher<cursor_type_t<RASequence>, function_type_t<BinaryPredicate>,
+                     function_type_t<Compare>>
+    make_two_way_searcher(RASequence && pattern,
+                          BinaryPredicate pred = BinaryPredicate(),
+                          Compare cmp = Compare())
+    {
+        using Result = two_way_searcher<cursor_type_t<RASequence>,
+                                        function_type_t<BinaryPredicate>,
+                                        function_type_t<Compare>>;
+        return Result(::ural::cursor_fwd<RASequence>(pattern),
+                      ::ural::make_callable(std::move(pred)),
+                      ::ural::make_callable(std::move(cmp)));
+    }
+}
+// namespace v1
+}
+// namespace ural
+
+#endif
+// Z_URAL_ALGORITHM_SEARCHERS_HPP_INCLUDED
@@ -66,6 +66,16 @@
 #include <ural/algorithm/non_modifying.hpp>
 #include <ural/sequence/adaptors/outdirected.hpp>
 #include <ural/sequence/adaptors/set_operations.hpp>
+#include <ural/thread.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace ural
 {
@@ -86,6 +96,30 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, Forward>));
 
+            using Contiguous = details::use_contiguous_ordering<Forward, Compare>;
+
+            return is_sorted_until_fn::impl(std::move(in), std::move(cmp), Contiguous{});
+        }
+
+        template <class Forward, class Compare>
+        static Forward
+        impl(Forward in, Compare, std::true_type)
+        {
+            in = details::contiguous_adjacent_find(std::move(in),
+                                                   details::elementwise_greater{});
+
+            if(!!in)
+            {
+                ++ in;
+            }
+
+            return in;
+        }
+
+        template <class Forward, class Compare>
+        static Forward
+        impl(Forward in, Compare cmp, std::false_type)
+        {
             auto cmp_2_1 = ::ural::experimental::make_binary_reverse_args(std::move(cmp));
 
             in = ural::adjacent_find_fn{}(std::move(in), std::move(cmp_2_1));
@@ -551,252 +585,2227 @@ inline namespace v1
         }
     };
 
-    // Сортировка
-    /** @ingroup SortingOperations
-    @brief Тип функционального объекта для сортировки вставками
-    */
-    class insertion_sort_fn
+    /// @cond false
+    namespace details
     {
-    public:
-        /** @brief Сортировка вставками
-        @param s сортируемая последовательность
-        @param cmp функция сравнения, по умолчанию используется
-        <tt> less<> </tt>, то есть оператор "меньше".
-        @return Последовательность, полученная из @c s путём продвижения до
-        исчерпания.
+        /** Интервалы, длина которых не превосходит этого значения, не
+        разделяются, а досортировываются вставками.
         */
-        template <class RASequence, class Compare>
-        cursor_type_t<RASequence>
-        operator()(RASequence && s, Compare cmp) const
+        constexpr std::ptrdiff_t introsort_threshold = 16;
+
+        /** Интервалы, длина которых превосходит это значение, разделяются
+        по псевдо-медиане девяти элементов (Tukey's ninther), более короткие
+        --- по медиане трёх.
+        */
+        constexpr std::ptrdiff_t ninther_threshold = 128;
+
+        template <class Size>
+        Size floor_log2(Size n)
         {
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+            assert(n > 0);
 
-            return this->impl(::ural::cursor_fwd<RASequence>(s),
-                              ::ural::make_callable(std::move(cmp)));
+            Size result = 0;
+            for(; n > 1; n /= 2)
+            {
+                ++ result;
+            }
+            return result;
         }
 
-    private:
+        // Вставка cur[pos] в отсортированную часть, предшествующую ему,
+        // где-то левее есть элемент, не больший cur[pos]
         template <class RACursor, class Compare>
-        static RACursor impl(RACursor cur, Compare cmp)
+        void unguarded_linear_insert(RACursor cur,
+                                     difference_type_t<RACursor> pos,
+                                     Compare & cmp)
         {
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
+            value_type_t<RACursor> tmp = std::move(cur[pos]);
 
-            if(!cur)
+            for(auto prev = pos - 1; cmp(tmp, cur[prev]); --prev)
             {
-                return cur;
+                cur[pos] = std::move(cur[prev]);
+                pos = prev;
             }
 
-            typedef decltype(cur.size()) Index;
+            cur[pos] = std::move(tmp);
+        }
+
+        template <class RACursor, class Compare>
+        void insertion_sort(RACursor cur,
+                            difference_type_t<RACursor> first,
+                            difference_type_t<RACursor> last,
+                            Compare & cmp)
+        {
+            if(first == last)
+            {
+                return;
+            }
 
-            for(Index i = 1; i != cur.size(); ++ i)
-            for(Index j = i; j > 0; -- j)
+            for(auto i = first + 1; i != last; ++ i)
             {
-                if(cmp(cur[j], cur[j-1]))
+                if(cmp(cur[i], cur[first]))
                 {
-                    ural::indirect_swap(cur, j, cur, j-1);
+                    value_type_t<RACursor> tmp = std::move(cur[i]);
+
+                    for(auto j = i; j != first; --j)
+                    {
+                        cur[j] = std::move(cur[j-1]);
+                    }
+
+                    cur[first] = std::move(tmp);
                 }
                 else
                 {
-                    break;
+                    details::unguarded_linear_insert(cur, i, cmp);
                 }
             }
-
-            cur += cur.size();
-            return cur;
         }
-    };
 
-    /** @ingroup SortingOperations
-    @brief Тип функционального объекта для устойчивой сортировки
-    */
-    class stable_sort_fn
-    {
-    public:
-        /** @brief Устойчивая сортировка, то есть сортировка, сохраняющая
-        относительный порядок эквивалентных элементов
-        @param s сортируемая последовательность
-        @param cmp функция сравнения, по умолчанию используется
-        <tt> less<> </tt>, то есть оператор "меньше".
-        @return Последовательность, полученная из @c s путём продвижения до
-        исчерпания.
-        */
-        template <class RASequence, class Compare = ::ural::less<>>
-        cursor_type_t<RASequence>
-        operator()(RASequence && s, Compare cmp = Compare()) const
+        template <class RACursor, class Compare>
+        void unguarded_insertion_sort(RACursor cur,
+                                      difference_type_t<RACursor> first,
+                                      difference_type_t<RACursor> last,
+                                      Compare & cmp)
         {
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
-
-            return this->impl(::ural::cursor_fwd<RASequence>(s),
-                              ::ural::make_callable(std::move(cmp)));
+            for(auto i = first; i != last; ++ i)
+            {
+                details::unguarded_linear_insert(cur, i, cmp);
+            }
         }
 
-    private:
+        // Упорядочивает элементы с индексами a, b, c
         template <class RACursor, class Compare>
-        static RACursor impl(RACursor cur, Compare cmp)
+        void sort_3(RACursor cur,
+                    difference_type_t<RACursor> a,
+                    difference_type_t<RACursor> b,
+                    difference_type_t<RACursor> c,
+                    Compare & cmp)
         {
-            return ::ural::insertion_sort_fn{}(std::move(cur), std::move(cmp));
+            if(cmp(cur[b], cur[a]))
+            {
+                ::ural::indirect_swap(cur, a, cur, b);
+            }
+            if(cmp(cur[c], cur[b]))
+            {
+                ::ural::indirect_swap(cur, b, cur, c);
+
+                if(cmp(cur[b], cur[a]))
+                {
+                    ::ural::indirect_swap(cur, a, cur, b);
+                }
+            }
         }
-    };
 
-    /** @ingroup SortingOperations
-    @brief Тип функционального объекта для частичной сортировки
-    */
-    class partial_sort_fn
-    {
-    public:
-        // @todo перегрузка, сортирующая traversed_front
-        /** @brief Частичная сортировка
-        @param s входная последовательность
-        @param part количество начальных элементов, которые должны быть
-        отсортированны
-        @param cmp функция сравнения, по умолчанию используется
-        <tt> less<> </tt>, то есть оператор "меньше".
-        @return Последовательность, полученная из
-        <tt> ::ural::cursor_fwd<RASequence>(s) </tt> продвижением до
-        исчерпания.
+        /* Разделение Хоара интервала [first, last) относительно cur[pivot],
+        где pivot < first. Поиск справа ограничен самим опорным элементом,
+        слева --- элементом, не меньшим опорного, который должен быть
+        в интервале.
         */
-        template <class RASequence, class Compare = ::ural::less<>>
-        cursor_type_t<RASequence>
-        operator()(RASequence && s,
-                   difference_type_t<cursor_type_t<RASequence>> part,
-                   Compare cmp = Compare()) const
+        template <class RACursor, class Compare>
+        difference_type_t<RACursor>
+        unguarded_partition(RACursor cur,
+                            difference_type_t<RACursor> first,
+                            difference_type_t<RACursor> last,
+                            difference_type_t<RACursor> pivot,
+                            Compare & cmp)
         {
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+            auto const & pivot_value = cur[pivot];
 
-            // @todo Подумать, что можно возвращать из impl
-            auto seq = ::ural::cursor_fwd<RASequence>(s);
-            this->impl(seq, std::move(part),
-                       ::ural::make_callable(std::move(cmp)));
-            seq += seq.size();
-            return seq;
+            for(;;)
+            {
+                for(; cmp(cur[first], pivot_value); ++first)
+                {}
+
+                -- last;
+
+                for(; cmp(pivot_value, cur[last]); --last)
+                {}
+
+                if(!(first < last))
+                {
+                    return first;
+                }
+
+                ::ural::indirect_swap(cur, first, cur, last);
+                ++ first;
+            }
         }
 
-    private:
+        /* Выбирает опорный элемент, помещает его в cur[first] и разделяет
+        остальную часть интервала. Возвращает индекс начала правой части.
+        */
         template <class RACursor, class Compare>
-        static void
-        impl(RACursor cur, difference_type_t<RACursor> const part, Compare cmp)
+        difference_type_t<RACursor>
+        unguarded_partition_pivot(RACursor cur,
+                                  difference_type_t<RACursor> first,
+                                  difference_type_t<RACursor> last,
+                                  Compare & cmp)
         {
-            make_heap_fn{}(cur, cmp);
-
-            cur.shrink_front();
-            auto const cur_old = cur;
-            cur += part;
+            auto const n = last - first;
+            auto const mid = first + n / 2;
 
-            for(auto i = cur; !!i; ++ i)
+            if(n > details::ninther_threshold)
             {
-                if(cmp(*i, *cur_old))
-                {
-                    ::ural::indirect_swap(cur_old, i);
-                    heap_sink_fn{}(cur.traversed_front(), 0*part, part, cmp);
-                }
+                details::sort_3(cur, first, mid, last - 1, cmp);
+                details::sort_3(cur, first + 1, mid - 1, last - 2, cmp);
+                details::sort_3(cur, first + 2, mid + 1, last - 3, cmp);
+                details::sort_3(cur, mid - 1, mid, mid + 1, cmp);
+            }
+            else
+            {
+                details::sort_3(cur, first + 1, mid, last - 1, cmp);
             }
 
-            sort_heap_fn{}(cur.traversed_front(), cmp);
+            ::ural::indirect_swap(cur, first, cur, mid);
+
+            return details::unguarded_partition(cur, first + 1, last, first, cmp);
         }
-    };
 
-    /** @ingroup SortingOperations
-    @brief Тип функционального объекта для копирование наименьших элементов
-    одной последовательности в другую по порядку
-    */
-    class partial_sort_copy_fn
-    {
-    public:
-        /** @brief Копирование наименьших элементов @c in в @c out по порядку
-        @param in входная последовательность
-        @param out выходная последовательность
-        @param cmp функция сравнения, по умолчанию используется
-        <tt> less<> </tt>, то есть оператор "меньше".
-        */
-        template <class Input, class RASequence, class Compare = ::ural::less<>>
-        cursor_type_t<RASequence>
-        operator()(Input && in, RASequence && out,
-                   Compare cmp = Compare()) const
+        template <class RACursor, class Compare>
+        void heap_sort(RACursor cur,
+                       difference_type_t<RACursor> first,
+                       difference_type_t<RACursor> last,
+                       Compare & cmp)
         {
-            BOOST_CONCEPT_ASSERT((concepts::InputSequence<Input>));
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
-            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<cursor_type_t<Input>,
-                                                               cursor_type_t<RASequence>>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+            auto sub = details::random_access_subcursor(cur, first, last);
 
-            return this->impl(::ural::cursor_fwd<Input>(in),
-                              ::ural::cursor_fwd<RASequence>(out),
-                              ::ural::make_callable(std::move(cmp)));
+            ::ural::make_heap_fn{}(sub, cmp);
+            ::ural::sort_heap_fn{}(sub, cmp);
         }
 
-    private:
-        template <class Input, class RACursor, class Compare>
-        static RACursor
-        impl(Input in, RACursor out, Compare cmp)
+        // Introselect
+        template <class RACursor, class Compare>
+        void median_of_medians_select(RACursor cur,
+                                      difference_type_t<RACursor> first,
+                                      difference_type_t<RACursor> last,
+                                      difference_type_t<RACursor> nth,
+                                      Compare & cmp);
+
+        /* Разделение относительно медианы медиан групп из пяти элементов.
+        Каждая из частей содержит не менее 3/10 элементов интервала, что
+        гарантирует линейное время выбора в худшем случае. Возвращает индекс
+        начала правой части.
+        */
+        template <class RACursor, class Compare>
+        difference_type_t<RACursor>
+        median_of_medians_partition(RACursor cur,
+                                    difference_type_t<RACursor> first,
+                                    difference_type_t<RACursor> last,
+                                    Compare & cmp)
         {
-            BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input>));
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
-            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Input, RACursor>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
+            auto medians_end = first;
 
-            out.shrink_front();
-            std::tie(in, out) = copy_fn{}(std::move(in), std::move(out));
+            for(auto i = first; last - i >= 5; i += 5)
+            {
+                details::insertion_sort(cur, i, i + 5, cmp);
+                ::ural::indirect_swap(cur, i + 2, cur, medians_end);
+                ++ medians_end;
+            }
 
-            auto to_sort = out.traversed_front();
-            auto const part = to_sort.size();
+            auto const mid = first + (medians_end - first) / 2;
+            details::median_of_medians_select(cur, first, medians_end, mid, cmp);
 
-            make_heap_fn{}(to_sort, cmp);
+            ::ural::indirect_swap(cur, first, cur, mid);
 
-            for(; !!in; ++ in)
+            return details::unguarded_partition(cur, first + 1, last, first, cmp);
+        }
+
+        template <class RACursor, class Compare>
+        void median_of_medians_select(RACursor cur,
+                                      difference_type_t<RACursor> first,
+                                      difference_type_t<RACursor> last,
+                                      difference_type_t<RACursor> nth,
+                                      Compare & cmp)
+        {
+            for(; last - first > details::introsort_threshold;)
             {
-                if(cmp(*in, *to_sort))
+                auto const cut
+                    = details::median_of_medians_partition(cur, first, last, cmp);
+
+                if(cut <= nth)
                 {
-                    *to_sort = *in;
-                    heap_sink_fn{}(to_sort, 0*part, part, cmp);
+                    first = cut;
+                }
+                else
+                {
+                    last = cut;
                 }
             }
 
-            sort_heap_fn{}(std::move(to_sort), cmp);
-
-            return out;
+            details::insertion_sort(cur, first, last, cmp);
         }
-    };
 
-    /** @ingroup SortingOperations
-    @brief Тип функционального объекта для быстрой сортировки
-    */
-    class sort_fn
-    {
-    public:
-        /** @brief Сортировка со сложностью <tt> N log(N) </tt>
-        @param s сортируемая последовательность
-        @param cmp функция сравнения, по умолчанию используется
-        <tt> less<> </tt>, то есть оператор "меньше".
-        @return Последовательность, полученная из @c s путём продвижения до
-        исчерпания.
+        /* Быстрый выбор с опорным элементом, выбираемым как медиана трёх
+        (девяти) элементов. При превышении глубины depth_limit выбор
+        продолжается по медиане медиан.
         */
-        template <class RASequence, class Compare = ::ural::less<>>
-        cursor_type_t<RASequence>
-        operator()(RASequence && s, Compare cmp = Compare()) const
-        {
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
-
-            return this->impl(::ural::cursor_fwd<RASequence>(s),
-                              ::ural::make_callable(std::move(cmp)));
-        }
-    private:
         template <class RACursor, class Compare>
-        static RACursor impl(RACursor cur, Compare cmp)
+        void introselect(RACursor cur,
+                         difference_type_t<RACursor> first,
+                         difference_type_t<RACursor> last,
+                         difference_type_t<RACursor> nth,
+                         difference_type_t<RACursor> depth_limit,
+                         Compare & cmp)
         {
-            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
-            BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
+            for(; last - first > details::introsort_threshold;)
+            {
+                if(depth_limit == 0)
+                {
+                    details::median_of_medians_select(cur, first, last, nth, cmp);
+                    return;
+                }
 
-            auto const n = ural::size(cur);
-            return ::ural::partial_sort_fn{}(std::move(cur), n, std::move(cmp));
-        }
-    };
+                -- depth_limit;
 
-    /** @ingroup SortingOperations
+                auto const cut
+                    = details::unguarded_partition_pivot(cur, first, last, cmp);
+
+                if(cut <= nth)
+                {
+                    first = cut;
+                }
+                else
+                {
+                    last = cut;
+                }
+            }
+
+            details::insertion_sort(cur, first, last, cmp);
+        }
+
+        // Pattern-defeating quicksort
+        /* Используется ли для данных функции сравнения и типа значения
+        разделение без ветвлений.
+        */
+        template <class Compare, class T>
+        struct is_branchless_comparison
+         : std::false_type
+        {};
+
+        template <class T>
+        struct is_branchless_comparison<::ural::less<>, T>
+         : std::is_arithmetic<T>
+        {};
+
+        template <class T>
+        struct is_branchless_comparison<::ural::greater<>, T>
+         : std::is_arithmetic<T>
+        {};
+
+        constexpr std::ptrdiff_t pdq_insertion_sort_threshold = 24;
+        constexpr std::ptrdiff_t pdq_partial_insertion_sort_limit = 8;
+        constexpr std::size_t pdq_block_size = 64;
+
+        /* Сортировка вставками, которая прекращается, если пришлось
+        переместить слишком много элементов. Возвращает true, если интервал
+        удалось отсортировать.
+        */
+        template <class RACursor, class Compare>
+        bool pdq_partial_insertion_sort(RACursor cur,
+                                        difference_type_t<RACursor> first,
+                                        difference_type_t<RACursor> last,
+                                        Compare & cmp)
+        {
+            if(first == last)
+            {
+                return true;
+            }
+
+            difference_type_t<RACursor> moved = 0;
+
+            for(auto i = first + 1; i != last; ++ i)
+            {
+                if(cmp(cur[i], cur[i-1]))
+                {
+                    value_type_t<RACursor> tmp = std::move(cur[i]);
+
+                    auto j = i;
+                    do
+                    {
+                        cur[j] = std::move(cur[j-1]);
+                        -- j;
+                    }
+                    while(j != first && cmp(tmp, cur[j-1]));
+
+                    cur[j] = std::move(tmp);
+                    moved += i - j;
+                }
+
+                if(moved > details::pdq_partial_insertion_sort_limit)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /* Разделение интервала относительно cur[first]: элементы меньшие
+        опорного --- слева, остальные --- справа. Возвращает позицию
+        опорного элемента и признак того, что интервал уже был разделён.
+        */
+        template <class RACursor, class Compare>
+        std::pair<difference_type_t<RACursor>, bool>
+        pdq_partition_right(RACursor cur,
+                            difference_type_t<RACursor> const first,
+                            difference_type_t<RACursor> const last,
+                            Compare & cmp)
+        {
+            value_type_t<RACursor> pivot = std::move(cur[first]);
+
+            auto i = first;
+            auto j = last;
+
+            // Медиана трёх гарантирует, что элемент не меньший опорного есть
+            while(cmp(cur[++i], pivot))
+            {}
+
+            if(i - 1 == first)
+            {
+                while(i < j && !cmp(cur[--j], pivot))
+                {}
+            }
+            else
+            {
+                while(!cmp(cur[--j], pivot))
+                {}
+            }
+
+            bool const already_partitioned = (i >= j);
+
+            for(; i < j;)
+            {
+                ::ural::indirect_swap(cur, i, cur, j);
+
+                while(cmp(cur[++i], pivot))
+                {}
+
+                while(!cmp(cur[--j], pivot))
+                {}
+            }
+
+            auto const pivot_pos = i - 1;
+            cur[first] = std::move(cur[pivot_pos]);
+            cur[pivot_pos] = std::move(pivot);
+
+            return std::make_pair(pivot_pos, already_partitioned);
+        }
+
+        /* Перемещение num пар элементов, отмеченных смещениями
+        offsets_l (от l_base) и offsets_r (назад от r_base)
+        */
+        template <class RACursor>
+        void pdq_swap_offsets(RACursor const & cur,
+                              difference_type_t<RACursor> l_base,
+                              difference_type_t<RACursor> r_base,
+                              unsigned char const * offsets_l,
+                              unsigned char const * offsets_r,
+                              std::size_t num, bool use_swaps)
+        {
+            if(use_swaps)
+            {
+                // Если количества элементов совпадают, то циклическая
+                // перестановка не сохранит разделение
+                for(std::size_t k = 0; k < num; ++ k)
+                {
+                    ::ural::indirect_swap(cur, l_base + offsets_l[k],
+                                          cur, r_base - offsets_r[k]);
+                }
+            }
+            else if(num > 0)
+            {
+                auto l = l_base + offsets_l[0];
+                auto r = r_base - offsets_r[0];
+
+                value_type_t<RACursor> tmp = std::move(cur[l]);
+                cur[l] = std::move(cur[r]);
+
+                for(std::size_t k = 1; k < num; ++ k)
+                {
+                    l = l_base + offsets_l[k];
+                    cur[r] = std::move(cur[l]);
+
+                    r = r_base - offsets_r[k];
+                    cur[l] = std::move(cur[r]);
+                }
+
+                cur[r] = std::move(tmp);
+            }
+        }
+
+        /* То же, что pdq_partition_right, но элементы, которые нужно
+        переставить, сначала собираются блоками без условных переходов
+        (BlockQuicksort, Edelkamp, Weiss), что исключает ошибки предсказания
+        ветвлений при сравнении арифметических значений.
+        */
+        template <class RACursor, class Compare>
+        std::pair<difference_type_t<RACursor>, bool>
+        pdq_partition_right_branchless(RACursor cur,
+                                       difference_type_t<RACursor> const first,
+                                       difference_type_t<RACursor> const last,
+                                       Compare & cmp)
+        {
+            using Index = difference_type_t<RACursor>;
+
+            value_type_t<RACursor> pivot = std::move(cur[first]);
+
+            auto i = first;
+            auto j = last;
+
+            while(cmp(cur[++i], pivot))
+            {}
+
+            if(i - 1 == first)
+            {
+                while(i < j && !cmp(cur[--j], pivot))
+                {}
+            }
+            else
+            {
+                while(!cmp(cur[--j], pivot))
+                {}
+            }
+
+            bool const already_partitioned = (i >= j);
+
+            if(!already_partitioned)
+            {
+                ::ural::indirect_swap(cur, i, cur, j);
+                ++ i;
+
+                alignas(64) unsigned char offsets_l[details::pdq_block_size];
+                alignas(64) unsigned char offsets_r[details::pdq_block_size];
+
+                auto l_base = i;
+                auto r_base = j;
+                std::size_t num_l = 0;
+                std::size_t num_r = 0;
+                std::size_t start_l = 0;
+                std::size_t start_r = 0;
+
+                for(; i < j;)
+                {
+                    auto const num_unknown = std::size_t(j - i);
+
+                    auto const left_split
+                        = (num_l == 0) ? (num_r == 0 ? num_unknown / 2 : num_unknown)
+                                       : 0;
+                    auto const right_split
+                        = (num_r == 0) ? (num_unknown - left_split) : 0;
+
+                    auto const l_count = std::min(left_split, details::pdq_block_size);
+                    for(std::size_t k = 0; k < l_count; ++ k)
+                    {
+                        offsets_l[num_l] = static_cast<unsigned char>(k);
+                        num_l += !cmp(cur[i], pivot);
+                        ++ i;
+                    }
+
+                    auto const r_count = std::min(right_split, details::pdq_block_size);
+                    for(std::size_t k = 0; k < r_count;)
+                    {
+                        offsets_r[num_r] = static_cast<unsigned char>(++k);
+                        num_r += cmp(cur[--j], pivot);
+                    }
+
+                    auto const num = std::min(num_l, num_r);
+                    details::pdq_swap_offsets(cur, l_base, r_base,
+                                              offsets_l + start_l,
+                                              offsets_r + start_r,
+                                              num, num_l == num_r);
+                    num_l -= num;
+                    num_r -= num;
+                    start_l += num;
+                    start_r += num;
+
+                    if(num_l == 0)
+                    {
+                        start_l = 0;
+                        l_base = i;
+                    }
+
+                    if(num_r == 0)
+                    {
+                        start_r = 0;
+                        r_base = j;
+                    }
+                }
+
+                // Все элементы просмотрены, осталось переставить остатки блока
+                if(num_l != 0)
+                {
+                    for(; num_l > 0; --num_l)
+                    {
+                        -- j;
+                        ::ural::indirect_swap(cur, l_base + Index(offsets_l[start_l + num_l - 1]),
+                                              cur, j);
+                    }
+                    i = j;
+                }
+
+                if(num_r != 0)
+                {
+                    for(; num_r > 0; --num_r)
+                    {
+                        ::ural::indirect_swap(cur, r_base - Index(offsets_r[start_r + num_r - 1]),
+                                              cur, i);
+                        ++ i;
+                    }
+                    j = i;
+                }
+            }
+
+            auto const pivot_pos = i - 1;
+            cur[first] = std::move(cur[pivot_pos]);
+            cur[pivot_pos] = std::move(pivot);
+
+            return std::make_pair(pivot_pos, already_partitioned);
+        }
+
+        /* Разделение, при котором элементы, эквивалентные опорному,
+        попадают в левую часть. Используется, когда опорный элемент
+        эквивалентен элементу, предшествующему интервалу: тогда левая часть
+        состоит из равных элементов и уже отсортирована.
+        */
+        template <class RACursor, class Compare>
+        difference_type_t<RACursor>
+        pdq_partition_left(RACursor cur,
+                           difference_type_t<RACursor> const first,
+                           difference_type_t<RACursor> const last,
+                           Compare & cmp)
+        {
+            value_type_t<RACursor> pivot = std::move(cur[first]);
+
+            auto i = first;
+            auto j = last;
+
+            while(cmp(pivot, cur[--j]))
+            {}
+
+            if(j + 1 == last)
+            {
+                while(i < j && !cmp(pivot, cur[++i]))
+                {}
+            }
+            else
+            {
+                while(!cmp(pivot, cur[++i]))
+                {}
+            }
+
+            for(; i < j;)
+            {
+                ::ural::indirect_swap(cur, i, cur, j);
+
+                while(cmp(pivot, cur[--j]))
+                {}
+
+                while(!cmp(pivot, cur[++i]))
+                {}
+            }
+
+            auto const pivot_pos = j;
+            cur[first] = std::move(cur[pivot_pos]);
+            cur[pivot_pos] = std::move(pivot);
+
+            return pivot_pos;
+        }
+
+        template <class RACursor, class Compare, class Branchless>
+        void pdq_sort_loop(RACursor cur,
+                           difference_type_t<RACursor> first,
+                           difference_type_t<RACursor> last,
+                           Compare & cmp, int bad_allowed, bool leftmost,
+                           Branchless branchless)
+        {
+            using Index = difference_type_t<RACursor>;
+
+            for(;;)
+            {
+                Index const size = last - first;
+
+                if(size < details::pdq_insertion_sort_threshold)
+                {
+                    if(leftmost)
+                    {
+                        details::insertion_sort(cur, first, last, cmp);
+                    }
+                    else
+                    {
+                        details::unguarded_insertion_sort(cur, first, last, cmp);
+                    }
+                    return;
+                }
+
+                auto const mid = first + size / 2;
+
+                if(size > details::ninther_threshold)
+                {
+                    details::sort_3(cur, first, mid, last - 1, cmp);
+                    details::sort_3(cur, first + 1, mid - 1, last - 2, cmp);
+                    details::sort_3(cur, first + 2, mid + 1, last - 3, cmp);
+                    details::sort_3(cur, mid - 1, mid, mid + 1, cmp);
+                    ::ural::indirect_swap(cur, first, cur, mid);
+                }
+                else
+                {
+                    details::sort_3(cur, mid, first, last - 1, cmp);
+                }
+
+                // Слева нет элементов, меньших cur[first - 1]: если опорный
+                // элемент ему эквивалентен, то равные элементы собираются
+                // слева и больше не рассматриваются
+                if(!leftmost && !cmp(cur[first - 1], cur[first]))
+                {
+                    first = details::pdq_partition_left(cur, first, last, cmp) + 1;
+                    continue;
+                }
+
+                auto const part = branchless
+                                ? details::pdq_partition_right_branchless(cur, first, last, cmp)
+                                : details::pdq_partition_right(cur, first, last, cmp);
+
+                auto const pivot_pos = part.first;
+                auto const l_size = pivot_pos - first;
+                auto const r_size = last - (pivot_pos + 1);
+
+                if(l_size < size / 8 || r_size < size / 8)
+                {
+                    // Слишком много плохих разделений --- гарантируем N log(N)
+                    if(-- bad_allowed == 0)
+                    {
+                        details::heap_sort(cur, first, last, cmp);
+                        return;
+                    }
+
+                    // Нарушаем закономерности, которые могли привести
+                    // к плохому разделению
+                    if(l_size >= details::pdq_insertion_sort_threshold)
+                    {
+                        ::ural::indirect_swap(cur, first, cur, first + l_size / 4);
+                        ::ural::indirect_swap(cur, pivot_pos - 1, cur, pivot_pos - l_size / 4);
+
+                        if(l_size > details::ninther_threshold)
+                        {
+                            ::ural::indirect_swap(cur, first + 1, cur, first + (l_size / 4 + 1));
+                            ::ural::indirect_swap(cur, first + 2, cur, first + (l_size / 4 + 2));
+                            ::ural::indirect_swap(cur, pivot_pos - 2, cur, pivot_pos - (l_size / 4 + 1));
+                            ::ural::indirect_swap(cur, pivot_pos - 3, cur, pivot_pos - (l_size / 4 + 2));
+                        }
+                    }
+
+                    if(r_size >= details::pdq_insertion_sort_threshold)
+                    {
+                        ::ural::indirect_swap(cur, pivot_pos + 1, cur, pivot_pos + (1 + r_size / 4));
+                        ::ural::indirect_swap(cur, last - 1, cur, last - r_size / 4);
+
+                        if(r_size > details::ninther_threshold)
+                        {
+                            ::ural::indirect_swap(cur, pivot_pos + 2, cur, pivot_pos + (2 + r_size / 4));
+                            ::ural::indirect_swap(cur, pivot_pos + 3, cur, pivot_pos + (3 + r_size / 4));
+                            ::ural::indirect_swap(cur, last - 2, cur, last - (1 + r_size / 4));
+                            ::ural::indirect_swap(cur, last - 3, cur, last - (2 + r_size / 4));
+                        }
+                    }
+                }
+                else if(part.second
+                        && details::pdq_partial_insertion_sort(cur, first, pivot_pos, cmp)
+                        && details::pdq_partial_insertion_sort(cur, pivot_pos + 1, last, cmp))
+                {
+                    // Интервал был уже разделён и почти отсортирован
+                    return;
+                }
+
+                details::pdq_sort_loop(cur, first, pivot_pos, cmp,
+                                       bad_allowed, leftmost, branchless);
+                first = pivot_pos + 1;
+                leftmost = false;
+            }
+        }
+
+        /* Проверяет, упорядочена ли последовательность по неубыванию или по
+        невозрастанию. Во втором случае обращает её. Время работы линейно,
+        но просмотр заканчивается на первом нарушении порядка.
+        */
+        template <class RACursor, class Compare>
+        bool pdq_handle_monotone(RACursor cur, Compare & cmp)
+        {
+            auto const n = cur.size();
+
+            auto i = 0*n + 1;
+            for(; i < n && !cmp(cur[i], cur[i-1]); ++ i)
+            {}
+
+            if(i >= n)
+            {
+                return true;
+            }
+
+            for(i = 1; i < n && !cmp(cur[i-1], cur[i]); ++ i)
+            {}
+
+            if(i >= n)
+            {
+                for(auto j = 0*n, k = n - 1; j < k; ++j, --k)
+                {
+                    ::ural::indirect_swap(cur, j, cur, k);
+                }
+                return true;
+            }
+
+            return false;
+        }
+
+        /** Серии (уже упорядоченные части), более короткие, чем это значение,
+        при устойчивой сортировке дополняются до него сортировкой вставками.
+        */
+        constexpr std::ptrdiff_t stable_sort_min_run = 32;
+
+        /* Экспоненциальный поиск первого элемента интервала [first, last),
+        большего value, начиная с first. Число сравнений логарифмически зависит
+        от расстояния до искомого элемента, а не от длины интервала.
+        */
+        template <class RACursor, class T, class Compare>
+        difference_type_t<RACursor>
+        gallop_upper_bound(RACursor cur, T const & value,
+                           difference_type_t<RACursor> first,
+                           difference_type_t<RACursor> last,
+                           Compare & cmp)
+        {
+            difference_type_t<RACursor> step = 1;
+
+            while(first + step <= last && !cmp(value, cur[first + step - 1]))
+            {
+                first += step;
+                step *= 2;
+            }
+
+            last = std::min(last, first + step - 1);
+
+            // Бинарный поиск в [first, last)
+            while(first < last)
+            {
+                auto const mid = first + (last - first) / 2;
+
+                if(cmp(value, cur[mid]))
+                {
+                    last = mid;
+                }
+                else
+                {
+                    first = mid + 1;
+                }
+            }
+            return first;
+        }
+
+        /* Экспоненциальный поиск первого элемента интервала [first, last),
+        не меньшего value, начиная с last.
+        */
+        template <class RACursor, class T, class Compare>
+        difference_type_t<RACursor>
+        gallop_lower_bound_back(RACursor cur, T const & value,
+                                difference_type_t<RACursor> first,
+                                difference_type_t<RACursor> last,
+                                Compare & cmp)
+        {
+            difference_type_t<RACursor> step = 1;
+
+            while(last - step >= first && !cmp(cur[last - step], value))
+            {
+                last -= step;
+                step *= 2;
+            }
+
+            first = std::max(first, last - step + 1);
+
+            // Бинарный поиск в [first, last)
+            while(first < last)
+            {
+                auto const mid = first + (last - first) / 2;
+
+                if(cmp(cur[mid], value))
+                {
+                    first = mid + 1;
+                }
+                else
+                {
+                    last = mid;
+                }
+            }
+            return first;
+        }
+
+        /* Слияние соседних упорядоченных интервалов [first, middle) и
+        [middle, last) с помощью inplace_merge_fn, которому буфер передаётся
+        в качестве рабочей памяти. Определена после inplace_merge_fn.
+        */
+        template <class RACursor, class Compare, class T>
+        void merge_with_scratch(RACursor cur,
+                                difference_type_t<RACursor> first,
+                                difference_type_t<RACursor> middle,
+                                difference_type_t<RACursor> last,
+                                Compare & cmp, temporary_buffer<T> & buffer);
+
+        /* Слияние интервала [first, middle), перемещённого в буфер, с
+        интервалом [middle, last) в направлении от начала к концу.
+        */
+        template <class RACursor, class Compare, class T>
+        void move_merge_forward(RACursor cur,
+                                difference_type_t<RACursor> first,
+                                difference_type_t<RACursor> middle,
+                                difference_type_t<RACursor> last,
+                                Compare & cmp, temporary_buffer<T> & buffer)
+        {
+            auto const n1 = middle - first;
+
+            buffer.move_from(cur, first, n1);
+            auto const buf = buffer.data();
+
+            difference_type_t<RACursor> i = 0;
+            auto out = first;
+
+            for(auto j = middle; i != n1 && j != last; ++ out)
+            {
+                if(cmp(cur[j], buf[i]))
+                {
+                    cur[out] = std::move(cur[j]);
+                    ++ j;
+                }
+                else
+                {
+                    cur[out] = std::move(buf[i]);
+                    ++ i;
+                }
+            }
+
+            for(; i != n1; ++i, ++out)
+            {
+                cur[out] = std::move(buf[i]);
+            }
+
+            buffer.clear();
+        }
+
+        /* Слияние интервала [first, middle) с интервалом [middle, last),
+        перемещённым в буфер, в направлении от конца к началу.
+        */
+        template <class RACursor, class Compare, class T>
+        void move_merge_backward(RACursor cur,
+                                 difference_type_t<RACursor> first,
+                                 difference_type_t<RACursor> middle,
+                                 difference_type_t<RACursor> last,
+                                 Compare & cmp, temporary_buffer<T> & buffer)
+        {
+            auto const n2 = last - middle;
+
+            buffer.move_from(cur, middle, n2);
+            auto const buf = buffer.data();
+
+            auto j = n2;
+            auto out = last;
+
+            for(auto i = middle; i != first && j != 0;)
+            {
+                -- out;
+
+                if(cmp(buf[j-1], cur[i-1]))
+                {
+                    -- i;
+                    cur[out] = std::move(cur[i]);
+                }
+                else
+                {
+                    -- j;
+                    cur[out] = std::move(buf[j]);
+                }
+            }
+
+            for(; j != 0; --j)
+            {
+                -- out;
+                cur[out] = std::move(buf[j-1]);
+            }
+
+            buffer.clear();
+        }
+
+        /* Устойчивое слияние соседних упорядоченных интервалов
+        [first, middle) и [middle, last). Элементы, уже стоящие на своих местах
+        в начале первого и в конце второго интервала, отбрасываются с помощью
+        экспоненциального поиска. Меньший из оставшихся интервалов перемещается
+        в буфер, если он там помещается, иначе слияние выполняется
+        inplace_merge_fn.
+        */
+        template <class RACursor, class Compare, class T>
+        void merge_adaptive(RACursor cur,
+                            difference_type_t<RACursor> first,
+                            difference_type_t<RACursor> middle,
+                            difference_type_t<RACursor> last,
+                            Compare & cmp,
+                            temporary_buffer<T> & buffer)
+        {
+            if(first == middle || middle == last
+               || !cmp(cur[middle], cur[middle - 1]))
+            {
+                return;
+            }
+
+            first = details::gallop_upper_bound(cur, cur[middle],
+                                                first, middle, cmp);
+            last = details::gallop_lower_bound_back(cur, cur[middle - 1],
+                                                    middle, last, cmp);
+
+            auto const n1 = middle - first;
+            auto const n2 = last - middle;
+
+            if(std::min(n1, n2) > difference_type_t<RACursor>(buffer.capacity()))
+            {
+                details::merge_with_scratch(cur, first, middle, last, cmp,
+                                            buffer);
+            }
+            else if(n1 <= n2)
+            {
+                details::move_merge_forward(cur, first, middle, last, cmp,
+                                            buffer);
+            }
+            else
+            {
+                details::move_merge_backward(cur, first, middle, last, cmp,
+                                             buffer);
+            }
+        }
+
+        /* Находит серию, начинающуюся с first: наибольший неубывающий или
+        строго убывающий интервал. Убывающая серия обращается (строгость
+        гарантирует устойчивость). Короткая серия дополняется до min_run
+        элементов сортировкой вставками. Возвращает конец серии.
+        */
+        template <class RACursor, class Compare>
+        difference_type_t<RACursor>
+        stable_sort_next_run(RACursor cur,
+                             difference_type_t<RACursor> first,
+                             difference_type_t<RACursor> last,
+                             Compare & cmp)
+        {
+            auto run_end = first + 1;
+
+            if(run_end == last)
+            {
+                return run_end;
+            }
+
+            if(cmp(cur[run_end], cur[first]))
+            {
+                for(++ run_end; run_end != last && cmp(cur[run_end], cur[run_end - 1]);
+                    ++ run_end)
+                {}
+
+                for(auto i = first, j = run_end - 1; i < j; ++i, --j)
+                {
+                    ::ural::indirect_swap(cur, i, cur, j);
+                }
+            }
+            else
+            {
+                for(++ run_end; run_end != last && !cmp(cur[run_end], cur[run_end - 1]);
+                    ++ run_end)
+                {}
+            }
+
+            using Index = difference_type_t<RACursor>;
+            Index const min_run = details::stable_sort_min_run;
+
+            if(run_end - first < min_run)
+            {
+                auto const new_end = std::min(last, first + min_run);
+
+                for(auto i = run_end; i != new_end; ++ i)
+                {
+                    if(cmp(cur[i], cur[first]))
+                    {
+                        value_type_t<RACursor> tmp = std::move(cur[i]);
+
+                        for(auto j = i; j != first; --j)
+                        {
+                            cur[j] = std::move(cur[j-1]);
+                        }
+
+                        cur[first] = std::move(tmp);
+                    }
+                    else
+                    {
+                        details::unguarded_linear_insert(cur, i, cmp);
+                    }
+                }
+
+                run_end = new_end;
+            }
+
+            return run_end;
+        }
+
+        /* Устойчивая сортировка естественным слиянием: последовательность
+        разбивается на серии, которые затем попарно сливаются, пока не
+        останется одна. Для последовательности из r серий выполняется
+        O(n log r) сравнений, в частности, O(n) для упорядоченной.
+        */
+        template <class RACursor, class Compare>
+        void natural_merge_sort(RACursor cur, Compare & cmp)
+        {
+            using Index = difference_type_t<RACursor>;
+
+            auto const n = cur.size();
+
+            std::vector<Index> bounds;
+            bounds.push_back(0);
+
+            for(auto first = 0*n; first != n;)
+            {
+                first = details::stable_sort_next_run(cur, first, n, cmp);
+                bounds.push_back(first);
+            }
+
+            if(bounds.size() <= 2)
+            {
+                return;
+            }
+
+            temporary_buffer<value_type_t<RACursor>> buffer((n + 1) / 2);
+
+            while(bounds.size() > 2)
+            {
+                auto out = bounds.begin() + 1;
+
+                auto i = 0*bounds.size();
+                for(; i + 2 < bounds.size(); i += 2)
+                {
+                    details::merge_adaptive(cur, bounds[i], bounds[i+1],
+                                            bounds[i+2], cmp, buffer);
+                    *out = bounds[i+2];
+                    ++ out;
+                }
+
+                if(i + 1 < bounds.size())
+                {
+                    *out = bounds[i+1];
+                    ++ out;
+                }
+
+                bounds.erase(out, bounds.end());
+            }
+        }
+
+        /* Сортировка обращается только к элементам с допустимыми индексами,
+        поэтому для курсоров на основе итераторов проверка индексов
+        отключается.
+        */
+        template <class RACursor>
+        RACursor unchecked_cursor(RACursor cur)
+        {
+            return cur;
+        }
+
+        template <class Iterator, class Policy>
+        iterator_cursor<Iterator, container_no_checks_policy>
+        unchecked_cursor(iterator_cursor<Iterator, Policy> cur)
+        {
+            return iterator_cursor<Iterator, container_no_checks_policy>(std::move(cur));
+        }
+
+        struct pdq_sorter
+        {
+            template <class RACursor, class Compare>
+            void operator()(RACursor cur, Compare & cmp) const
+            {
+                auto const n = cur.size();
+
+                if(n < 2)
+                {
+                    return;
+                }
+
+                auto raw = details::unchecked_cursor(std::move(cur));
+
+                if(!details::pdq_handle_monotone(raw, cmp))
+                {
+                    using Branchless
+                        = details::is_branchless_comparison<Compare, value_type_t<RACursor>>;
+
+                    details::pdq_sort_loop(raw, 0*n, n, cmp,
+                                           static_cast<int>(details::floor_log2(n)),
+                                           true, Branchless{});
+                }
+            }
+        };
+
+        struct natural_merge_sorter
+        {
+            template <class RACursor, class Compare>
+            void operator()(RACursor cur, Compare & cmp) const
+            {
+                if(cur.size() > 1)
+                {
+                    details::natural_merge_sort(cur, cmp);
+                }
+            }
+        };
+
+        // Параллельная сортировка слиянием
+        /** Интервалы, длина которых меньше этого значения, сортируются и
+        сливаются в одном потоке.
+        */
+        constexpr std::ptrdiff_t parallel_sort_grain = 1 << 14;
+
+        /* Слияние упорядоченных интервалов [first_1, last_1) и
+        [first_2, last_2) курсора src с перемещением в dst, начиная с out.
+        */
+        template <class Source, class Target, class Compare>
+        void move_merge(Source src,
+                        difference_type_t<Source> first_1,
+                        difference_type_t<Source> last_1,
+                        difference_type_t<Source> first_2,
+                        difference_type_t<Source> last_2,
+                        Target dst, difference_type_t<Target> out,
+                        Compare & cmp)
+        {
+            for(; first_1 != last_1 && first_2 != last_2; ++ out)
+            {
+                if(cmp(src[first_2], src[first_1]))
+                {
+                    dst[out] = std::move(src[first_2]);
+                    ++ first_2;
+                }
+                else
+                {
+                    dst[out] = std::move(src[first_1]);
+                    ++ first_1;
+                }
+            }
+
+            for(; first_1 != last_1; ++ first_1, ++ out)
+            {
+                dst[out] = std::move(src[first_1]);
+            }
+
+            for(; first_2 != last_2; ++ first_2, ++ out)
+            {
+                dst[out] = std::move(src[first_2]);
+            }
+        }
+
+        /* Параллельный вариант move_merge: больший из интервалов делится
+        пополам, меньший --- бинарным поиском по элементу деления, после чего
+        две пары частей сливаются независимо.
+        */
+        template <class Source, class Target, class Compare>
+        void parallel_move_merge(Source src,
+                                 difference_type_t<Source> first_1,
+                                 difference_type_t<Source> last_1,
+                                 difference_type_t<Source> first_2,
+                                 difference_type_t<Source> last_2,
+                                 Target dst, difference_type_t<Target> out,
+                                 std::size_t threads, Compare & cmp)
+        {
+            auto const n1 = last_1 - first_1;
+            auto const n2 = last_2 - first_2;
+
+            if(threads <= 1 || n1 + n2 < details::parallel_sort_grain
+               || n1 == 0 || n2 == 0)
+            {
+                details::move_merge(src, first_1, last_1, first_2, last_2,
+                                    dst, out, cmp);
+                return;
+            }
+
+            auto mid_1 = first_1;
+            auto mid_2 = first_2;
+
+            // Эквивалентные элементы первого интервала должны остаться левее
+            if(n1 >= n2)
+            {
+                mid_1 = first_1 + n1 / 2;
+                mid_2 = details::gallop_lower_bound_back(src, src[mid_1],
+                                                         first_2, last_2, cmp);
+            }
+            else
+            {
+                mid_2 = first_2 + n2 / 2;
+                mid_1 = details::gallop_upper_bound(src, src[mid_2],
+                                                    first_1, last_1, cmp);
+            }
+
+            auto const out_mid = out + (mid_1 - first_1) + (mid_2 - first_2);
+            auto const threads_2 = threads / 2;
+
+            ::ural::details::parallel_invoke(true,
+                [&]{ details::parallel_move_merge(src, first_1, mid_1,
+                                                  first_2, mid_2, dst, out,
+                                                  threads - threads_2, cmp); },
+                [&]{ details::parallel_move_merge(src, mid_1, last_1,
+                                                  mid_2, last_2, dst, out_mid,
+                                                  threads_2, cmp); });
+        }
+
+        /* Сортирует [first, last), элементы которого находятся в буфере.
+        Листья дерева рекурсии сортируют свою часть буфера с помощью sorter,
+        остальные узлы сливают результаты потомков, чередуя буфер и cur:
+        результат узла находится в cur, если to_cursor истинно, иначе --- в
+        буфере.
+        */
+        template <class RACursor, class BufferCursor, class Sorter, class Compare>
+        void parallel_merge_sort_loop(RACursor cur, BufferCursor buf,
+                                      difference_type_t<RACursor> first,
+                                      difference_type_t<RACursor> last,
+                                      int depth, bool to_cursor,
+                                      std::size_t threads,
+                                      Sorter const & sorter, Compare & cmp)
+        {
+            if(depth == 0)
+            {
+                assert(!to_cursor);
+
+                sorter(details::random_access_subcursor(buf, first, last), cmp);
+                return;
+            }
+
+            auto const mid = first + (last - first) / 2;
+            auto const threads_2 = threads / 2;
+
+            ::ural::details::parallel_invoke(threads > 1,
+                [&]{ details::parallel_merge_sort_loop(cur, buf, first, mid,
+                                                       depth - 1, !to_cursor,
+                                                       threads - threads_2,
+                                                       sorter, cmp); },
+                [&]{ details::parallel_merge_sort_loop(cur, buf, mid, last,
+                                                       depth - 1, !to_cursor,
+                                                       std::max(threads_2, std::size_t{1}),
+                                                       sorter, cmp); });
+
+            if(to_cursor)
+            {
+                details::parallel_move_merge(buf, first, mid, mid, last,
+                                             cur, first, threads, cmp);
+            }
+            else
+            {
+                details::parallel_move_merge(cur, first, mid, mid, last,
+                                             buf, first, threads, cmp);
+            }
+        }
+
+        /* Параллельная сортировка: последовательность делится на 2^depth
+        частей, где depth --- наименьшее нечётное число, при котором частей
+        не меньше, чем потоков. Части сортируются независимо с помощью sorter,
+        затем попарно сливаются параллельным слиянием. Сортировка устойчива,
+        если устойчив sorter. Если потоков недостаточно или не удалось
+        выделить буфер для всей последовательности, то она просто сортируется
+        с помощью sorter.
+        */
+        template <class RACursor, class Sorter, class Compare>
+        void parallel_merge_sort(RACursor cur, std::size_t threads,
+                                 Sorter const & sorter, Compare & cmp)
+        {
+            using Index = difference_type_t<RACursor>;
+            using Value = value_type_t<RACursor>;
+
+            Index const n = cur.size();
+
+            threads = std::min(threads,
+                               static_cast<std::size_t>(n / details::parallel_sort_grain));
+
+            if(threads <= 1)
+            {
+                sorter(cur, cmp);
+                return;
+            }
+
+            temporary_buffer<Value> buffer(n);
+
+            if(buffer.capacity() < n)
+            {
+                sorter(cur, cmp);
+                return;
+            }
+
+            int depth = 1;
+            for(; (std::size_t{1} << depth) < threads; depth += 2)
+            {}
+
+            /* Элементы создаются в буфере до начала параллельной части, чтобы
+            при исключении в любом из потоков буфер уничтожил их все.
+            */
+            buffer.move_from(cur, Index{0}, n);
+
+            auto const buf = ::ural::iterator_cursor<Value *>(buffer.data(),
+                                                               buffer.data() + n);
+
+            details::parallel_merge_sort_loop(cur, buf, Index{0}, n,
+                                              depth, true, threads, sorter, cmp);
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    // Сортировка
+    /** @ingroup SortingOperations
+    @brief Тип функционального объекта для сортировки вставками
+    */
+    class insertion_sort_fn
+    {
+    public:
+        /** @brief Сортировка вставками
+        @param s сортируемая последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из @c s путём продвижения до
+        исчерпания.
+        */
+        template <class RASequence, class Compare>
+        cursor_type_t<RASequence>
+        operator()(RASequence && s, Compare cmp) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            return this->impl(::ural::cursor_fwd<RASequence>(s),
+                              ::ural::make_callable(std::move(cmp)));
+        }
+
+    private:
+        template <class RACursor, class Compare>
+        static RACursor impl(RACursor cur, Compare cmp)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
+
+            auto const n = cur.size();
+
+            details::insertion_sort(cur, 0*n, n, cmp);
+
+            cur += n;
+            return cur;
+        }
+    };
+
+    /** @ingroup SortingOperations
+    @brief Тип функционального объекта для устойчивой сортировки
+    */
+    class stable_sort_fn
+    {
+    public:
+        /** @brief Устойчивая сортировка, то есть сортировка, сохраняющая
+        относительный порядок эквивалентных элементов
+        @param s сортируемая последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из @c s путём продвижения до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(RASequence && s, Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            return this->impl(::ural::cursor_fwd<RASequence>(s),
+                              ::ural::make_callable(std::move(cmp)));
+        }
+
+        /** @brief Параллельная устойчивая сортировка
+        @details Последовательность делится на части, которые сортируются
+        в отдельных потоках так же, как и в последовательном варианте, а затем
+        сливаются параллельным устойчивым слиянием. Требуется буфер для всей
+        последовательности, если его не удаётся выделить, то сортировка
+        выполняется в одном потоке.
+        @param policy стратегия выполнения
+        @param s сортируемая последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из @c s путём продвижения до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(parallel_execution_policy const & policy,
+                   RASequence && s, Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            auto cur = ::ural::cursor_fwd<RASequence>(s);
+            auto f_cmp = ::ural::make_callable(std::move(cmp));
+
+            details::parallel_merge_sort(cur, policy.threads(),
+                                         details::natural_merge_sorter{}, f_cmp);
+
+            cur += cur.size();
+            return cur;
+        }
+
+    private:
+        template <class RACursor, class Compare>
+        static RACursor impl(RACursor cur, Compare cmp)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
+
+            details::natural_merge_sorter{}(cur, cmp);
+
+            cur += cur.size();
+            return cur;
+        }
+    };
+
+    /** @ingroup SortingOperations
+    @brief Тип функционального объекта для частичной сортировки
+    */
+    class partial_sort_fn
+    {
+    public:
+        // @todo перегрузка, сортирующая traversed_front
+        /** @brief Частичная сортировка
+        @param s входная последовательность
+        @param part количество начальных элементов, которые должны быть
+        отсортированны
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из
+        <tt> ::ural::cursor_fwd<RASequence>(s) </tt> продвижением до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(RASequence && s,
+                   difference_type_t<cursor_type_t<RASequence>> part,
+                   Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            // @todo Подумать, что можно возвращать из impl
+            auto seq = ::ural::cursor_fwd<RASequence>(s);
+            this->impl(seq, std::move(part),
+                       ::ural::make_callable(std::move(cmp)));
+            seq += seq.size();
+            return seq;
+        }
+
+        /** @brief Параллельная частичная сортировка
+        @details Сначала за линейное время отбираются @c part наименьших
+        элементов (см. @c nth_element_fn), затем они сортируются параллельно
+        (см. @c sort_fn).
+        @param policy стратегия выполнения
+        @param s входная последовательность
+        @param part количество начальных элементов, которые должны быть
+        отсортированны
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из
+        <tt> ::ural::cursor_fwd<RASequence>(s) </tt> продвижением до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(parallel_execution_policy const & policy,
+                   RASequence && s,
+                   difference_type_t<cursor_type_t<RASequence>> part,
+                   Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            auto seq = ::ural::cursor_fwd<RASequence>(s);
+            auto f_cmp = ::ural::make_callable(std::move(cmp));
+
+            auto cur = seq;
+            cur.shrink_front();
+
+            auto const n = cur.size();
+            assert(0 <= part && part <= n);
+
+            if(part < n)
+            {
+                details::introselect(cur, 0*n, n, part,
+                                     2 * details::floor_log2(n), f_cmp);
+            }
+
+            details::parallel_merge_sort(details::random_access_subcursor(cur, 0*n, part),
+                                         policy.threads(),
+                                         details::pdq_sorter{}, f_cmp);
+
+            seq += seq.size();
+            return seq;
+        }
+
+    private:
+        template <class RACursor, class Compare>
+        static void
+        impl(RACursor cur, difference_type_t<RACursor> const part, Compare cmp)
+        {
+            make_heap_fn{}(cur, cmp);
+
+            cur.shrink_front();
+            auto const cur_old = cur;
+            cur += part;
+
+            for(auto i = cur; !!i; ++ i)
+            {
+                if(cmp(*i, *cur_old))
+                {
+                    ::ural::indirect_swap(cur_old, i);
+                    heap_sink_fn{}(cur.traversed_front(), 0*part, part, cmp);
+                }
+            }
+
+            sort_heap_fn{}(cur.traversed_front(), cmp);
+        }
+    };
+
+    /** @ingroup SortingOperations
+    @brief Тип функционального объекта для копирование наименьших элементов
+    одной последовательности в другую по порядку
+    */
+    class partial_sort_copy_fn
+    {
+    public:
+        /** @brief Копирование наименьших элементов @c in в @c out по порядку
+        @param in входная последовательность
+        @param out выходная последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        */
+        template <class Input, class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(Input && in, RASequence && out,
+                   Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::InputSequence<Input>));
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<cursor_type_t<Input>,
+                                                               cursor_type_t<RASequence>>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            return this->impl(::ural::cursor_fwd<Input>(in),
+                              ::ural::cursor_fwd<RASequence>(out),
+                              ::ural::make_callable(std::move(cmp)));
+        }
+
+    private:
+        template <class Input, class RACursor, class Compare>
+        static RACursor
+        impl(Input in, RACursor out, Compare cmp)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input>));
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<Input, RACursor>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
+
+            out.shrink_front();
+            std::tie(in, out) = copy_fn{}(std::move(in), std::move(out));
+
+            auto to_sort = out.traversed_front();
+            auto const part = to_sort.size();
+
+            make_heap_fn{}(to_sort, cmp);
+
+            for(; !!in; ++ in)
+            {
+                if(cmp(*in, *to_sort))
+                {
+                    *to_sort = *in;
+                    heap_sink_fn{}(to_sort, 0*part, part, cmp);
+                }
+            }
+
+            sort_heap_fn{}(std::move(to_sort), cmp);
+
+            return out;
+        }
+    };
+
+    /** @ingroup SortingOperations
+    @brief Тип функционального объекта для быстрой сортировки
+    */
+    class sort_fn
+    {
+    public:
+        /** @brief Сортировка со сложностью <tt> N log(N) </tt>
+        @details Используется сортировка, учитывающая закономерности во
+        входных данных (pattern-defeating quicksort): быстрая сортировка с
+        выбором опорного элемента как медианы трёх (для длинных интервалов
+        --- девяти) элементов, которая после слишком большого количества
+        плохих разделений переходит к пирамидальной сортировке, а короткие
+        интервалы досортировывает вставками. Упорядоченные по возрастанию или
+        по убыванию последовательности обрабатываются за линейное время. Если
+        @c cmp --- это <tt> ural::less<> </tt> или <tt> ural::greater<> </tt>,
+        а элементы имеют арифметический тип, то используется разделение без
+        условных переходов. Классическая интроспективная сортировка здесь
+        не используется: она уступает в скорости как @c std::sort, так и
+        этому алгоритму.
+        @param s сортируемая последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из @c s путём продвижения до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(RASequence && s, Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            return this->impl(::ural::cursor_fwd<RASequence>(s),
+                              ::ural::make_callable(std::move(cmp)));
+        }
+
+        /** @brief Параллельная сортировка
+        @details Последовательность делится на части, которые сортируются
+        в отдельных потоках так же, как и в последовательном варианте, а затем
+        сливаются параллельным слиянием. Требуется буфер для всей
+        последовательности, если его не удаётся выделить, то сортировка
+        выполняется в одном потоке.
+        @param policy стратегия выполнения
+        @param s сортируемая последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из @c s путём продвижения до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(parallel_execution_policy const & policy,
+                   RASequence && s, Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            auto cur = ::ural::cursor_fwd<RASequence>(s);
+            auto f_cmp = ::ural::make_callable(std::move(cmp));
+
+            details::parallel_merge_sort(cur, policy.threads(),
+                                         details::pdq_sorter{}, f_cmp);
+
+            cur += cur.size();
+            return cur;
+        }
+
+    private:
+        template <class RACursor, class Compare>
+        static RACursor impl(RACursor cur, Compare cmp)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
+
+            details::pdq_sorter{}(cur, cmp);
+
+            cur += cur.size();
+            return cur;
+        }
+    };
+
+    /** @ingroup SortingOperations
+    @brief Тип функционального объекта для сортировки, учитывающей
+    закономерности во входных данных (pattern-defeating quicksort).
+    */
+    class pdq_sort_fn
+    {
+    public:
+        /** @brief Сортировка со сложностью <tt> N log(N) </tt>, которая
+        выполняется за линейное время для упорядоченных по возрастанию или по
+        убыванию последовательностей.
+        @details Эта сортировка используется в @c sort_fn по умолчанию,
+        поэтому вызов равносилен вызову @c sort_fn. Функциональный объект
+        позволяет явно потребовать данный алгоритм.
+        @param s сортируемая последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Последовательность, полученная из @c s путём продвижения до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(RASequence && s, Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            return ::ural::sort_fn{}(std::forward<RASequence>(s), std::move(cmp));
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        // Поразрядная сортировка
+        struct radix_identity_key
+        {
+            template <class T>
+            constexpr T const & operator()(T const & x) const
+            {
+                return x;
+            }
+        };
+
+        /* Преобразование числового ключа в беззнаковое целое, порядок которого
+        совпадает с порядком ключей: у знаковых целых инвертируется знаковый
+        бит, у чисел с плавающей точкой --- знаковый бит для положительных
+        чисел и все биты для отрицательных.
+        */
+        template <class T, class = void>
+        struct radix_numeric_key;
+
+        template <class T>
+        struct radix_numeric_key<T, typename std::enable_if<std::is_integral<T>::value
+                                                            && !std::is_same<T, bool>::value>::type>
+        {
+            using type = typename std::make_unsigned<T>::type;
+
+            static type apply(T x)
+            {
+                auto const result = static_cast<type>(x);
+
+                if(std::is_signed<T>::value)
+                {
+                    return result ^ (type(1) << (8 * sizeof(type) - 1));
+                }
+                else
+                {
+                    return result;
+                }
+            }
+        };
+
+        // Для bool не определён make_unsigned
+        template <>
+        struct radix_numeric_key<bool>
+        {
+            using type = unsigned char;
+
+            static type apply(bool x)
+            {
+                return x;
+            }
+        };
+
+        template <class T>
+        struct radix_numeric_key<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+        {
+            static_assert(sizeof(T) == sizeof(std::uint32_t)
+                          || sizeof(T) == sizeof(std::uint64_t),
+                          "Unsupported floating point type");
+
+            using type = typename std::conditional<sizeof(T) == sizeof(std::uint32_t),
+                                                   std::uint32_t, std::uint64_t>::type;
+
+            static type apply(T x)
+            {
+                type bits;
+                std::memcpy(&bits, &x, sizeof(bits));
+
+                auto const sign_bit = type(1) << (8 * sizeof(type) - 1);
+
+                return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+            }
+        };
+
+        // Перечисления упорядочиваются как их базовые целые типы
+        template <class T>
+        struct radix_numeric_key<T, typename std::enable_if<std::is_enum<T>::value>::type>
+        {
+            using underlying_type = typename std::underlying_type<T>::type;
+            using type = typename radix_numeric_key<underlying_type>::type;
+
+            static type apply(T x)
+            {
+                return radix_numeric_key<underlying_type>::apply(static_cast<underlying_type>(x));
+            }
+        };
+
+        /* Функция сравнения по преобразованным числовым ключам, используется,
+        если не удалось выделить буфер.
+        */
+        template <class KeyFunction, class Key>
+        struct radix_numeric_compare
+        {
+            template <class T1, class T2>
+            bool operator()(T1 const & x, T2 const & y) const
+            {
+                return radix_numeric_key<Key>::apply(key(x))
+                     < radix_numeric_key<Key>::apply(key(y));
+            }
+
+            KeyFunction & key;
+        };
+
+        /* Поразрядная сортировка от младших разрядов (LSD) для числовых
+        ключей с основанием 256. Гистограммы всех разрядов вычисляются за
+        один проход, разряды, значение которых одинаково у всех элементов,
+        пропускаются. Элементы переносятся между последовательностью и
+        буфером, при первом переносе элементы буфера создаются.
+        */
+        template <class RACursor, class KeyFunction, class Key>
+        void lsd_radix_sort(RACursor cur, KeyFunction & key, declare_type<Key>)
+        {
+            using Index = difference_type_t<RACursor>;
+            using Value = value_type_t<RACursor>;
+            using Traits = radix_numeric_key<Key>;
+            using Unsigned = typename Traits::type;
+
+            constexpr std::size_t digits = sizeof(Unsigned);
+
+            Index const n = cur.size();
+
+            Index counts[digits][256] = {};
+
+            for(auto i = 0*n; i != n; ++ i)
+            {
+                auto const u = Traits::apply(key(cur[i]));
+
+                for(std::size_t d = 0; d != digits; ++ d)
+                {
+                    ++ counts[d][(u >> (8 * d)) & 0xFF];
+                }
+            }
+
+            std::size_t passes[digits] = {};
+            std::size_t passes_count = 0;
+
+            for(std::size_t d = 0; d != digits; ++ d)
+            {
+                auto const u0 = (Traits::apply(key(cur[0])) >> (8 * d)) & 0xFF;
+
+                if(counts[d][u0] != n)
+                {
+                    passes[passes_count] = d;
+                    ++ passes_count;
+                }
+            }
+
+            if(passes_count == 0)
+            {
+                return;
+            }
+
+            temporary_buffer<Value> buffer(n);
+
+            // Сортировка слиянием сохраняет устойчивость и при нехватке памяти
+            if(buffer.capacity() < n)
+            {
+                radix_numeric_compare<KeyFunction, Key> cmp{key};
+                details::natural_merge_sorter{}(cur, cmp);
+                return;
+            }
+
+            auto const buf = ::ural::iterator_cursor<Value *>(buffer.data(),
+                                                               buffer.data() + n);
+
+            for(std::size_t p = 0; p != passes_count; ++ p)
+            {
+                auto const d = passes[p];
+
+                Index offsets[256];
+                Index sum = 0;
+
+                for(std::size_t b = 0; b != 256; ++ b)
+                {
+                    offsets[b] = sum;
+                    sum += counts[d][b];
+                }
+
+                auto const bucket = [&](Value const & x)
+                {
+                    return (Traits::apply(key(x)) >> (8 * d)) & 0xFF;
+                };
+
+                if(p == 0)
+                {
+                    Index starts[256];
+                    std::copy(offsets, offsets + 256, starts);
+
+                    try
+                    {
+                        for(auto i = 0*n; i != n; ++ i)
+                        {
+                            buffer.construct(offsets[bucket(cur[i])] ++,
+                                             std::move(cur[i]));
+                        }
+                    }
+                    catch(...)
+                    {
+                        // Созданные элементы каждой корзины идут подряд
+                        for(std::size_t b = 0; b != 256; ++ b)
+                        {
+                            for(auto i = starts[b]; i != offsets[b]; ++ i)
+                            {
+                                buffer.destroy(i);
+                            }
+                        }
+                        throw;
+                    }
+
+                    buffer.assume_constructed(n);
+                }
+                else if(p % 2 == 1)
+                {
+                    for(auto i = 0*n; i != n; ++ i)
+                    {
+                        cur[offsets[bucket(buf[i])] ++] = std::move(buf[i]);
+                    }
+                }
+                else
+                {
+                    for(auto i = 0*n; i != n; ++ i)
+                    {
+                        buf[offsets[bucket(cur[i])] ++] = std::move(cur[i]);
+                    }
+                }
+            }
+
+            if(passes_count % 2 == 1)
+            {
+                for(auto i = 0*n; i != n; ++ i)
+                {
+                    cur[i] = std::move(buf[i]);
+                }
+            }
+        }
+
+        /** Интервалы, длина которых меньше этого значения, при поразрядной
+        сортировке строк досортировываются вставками.
+        */
+        constexpr std::ptrdiff_t msd_radix_sort_threshold = 32;
+
+        // Лексикографическое сравнение строк как последовательностей байтов
+        template <class KeyFunction>
+        struct radix_string_compare
+        {
+            template <class T1, class T2>
+            bool operator()(T1 const & x, T2 const & y) const
+            {
+                auto const & s1 = key(x);
+                auto const & s2 = key(y);
+
+                auto const n1 = s1.size();
+                auto const n2 = s2.size();
+
+                for(decltype(s1.size()) i = 0; i != n1 && i != n2; ++ i)
+                {
+                    auto const c1 = static_cast<unsigned char>(s1[i]);
+                    auto const c2 = static_cast<unsigned char>(s2[i]);
+
+                    if(c1 != c2)
+                    {
+                        return c1 < c2;
+                    }
+                }
+
+                return n1 < n2;
+            }
+
+            KeyFunction & key;
+        };
+
+        /* Номер корзины элемента при поразрядной сортировке строк: 0 для
+        строк, длина которых не больше depth, иначе --- байт depth плюс один.
+        */
+        template <class KeyFunction, class T>
+        std::size_t radix_string_bucket(KeyFunction & key, T const & x,
+                                        std::size_t depth)
+        {
+            auto const & s = key(x);
+
+            if(static_cast<std::size_t>(s.size()) <= depth)
+            {
+                return 0;
+            }
+
+            return static_cast<unsigned char>(s[depth]) + 1;
+        }
+
+        /* Поразрядная сортировка строк от старших разрядов (MSD) без
+        дополнительной памяти: элементы переставляются по корзинам циклами
+        обменов (American flag sort), затем каждая корзина, кроме корзины
+        закончившихся строк, сортируется по следующему байту.
+        */
+        template <class RACursor, class KeyFunction>
+        void msd_radix_sort(RACursor cur,
+                            difference_type_t<RACursor> first,
+                            difference_type_t<RACursor> last,
+                            std::size_t depth,
+                            KeyFunction & key)
+        {
+            using Index = difference_type_t<RACursor>;
+
+            constexpr std::size_t buckets = 257;
+
+            for(;;)
+            {
+                if(last - first < details::msd_radix_sort_threshold)
+                {
+                    radix_string_compare<KeyFunction> cmp{key};
+                    details::insertion_sort(cur, first, last, cmp);
+                    return;
+                }
+
+                Index counts[buckets] = {};
+
+                for(auto i = first; i != last; ++ i)
+                {
+                    ++ counts[details::radix_string_bucket(key, cur[i], depth)];
+                }
+
+                // Все строки имеют общий байт depth: переходим к следующему
+                auto const b0 = details::radix_string_bucket(key, cur[first], depth);
+
+                if(counts[b0] == last - first)
+                {
+                    if(b0 == 0)
+                    {
+                        return;
+                    }
+
+                    ++ depth;
+                    continue;
+                }
+
+                Index next[buckets];
+                Index ends[buckets];
+
+                auto sum = first;
+                for(std::size_t b = 0; b != buckets; ++ b)
+                {
+                    next[b] = sum;
+                    sum += counts[b];
+                    ends[b] = sum;
+                }
+
+                for(std::size_t b = 0; b != buckets; ++ b)
+                {
+                    while(next[b] != ends[b])
+                    {
+                        auto const target
+                            = details::radix_string_bucket(key, cur[next[b]], depth);
+
+                        if(target == b)
+                        {
+                            ++ next[b];
+                        }
+                        else
+                        {
+                            ::ural::indirect_swap(cur, next[b], cur, next[target]);
+                            ++ next[target];
+                        }
+                    }
+                }
+
+                // Рекурсия выполняется для всех корзин, кроме самой большой,
+                // которая обрабатывается следующей итерацией цикла. Поэтому
+                // глубина рекурсии не превосходит log(N)
+                std::size_t b_max = 1;
+
+                for(std::size_t b = 2; b != buckets; ++ b)
+                {
+                    if(counts[b] > counts[b_max])
+                    {
+                        b_max = b;
+                    }
+                }
+
+                for(std::size_t b = 1; b != buckets; ++ b)
+                {
+                    if(b != b_max && counts[b] > 1)
+                    {
+                        details::msd_radix_sort(cur, ends[b] - counts[b], ends[b],
+                                                depth + 1, key);
+                    }
+                }
+
+                first = ends[b_max] - counts[b_max];
+                last = ends[b_max];
+                ++ depth;
+            }
+        }
+
+        template <class RACursor, class KeyFunction, class Key>
+        void radix_sort(RACursor cur, KeyFunction & key, declare_type<Key> tag,
+                        std::true_type)
+        {
+            details::lsd_radix_sort(cur, key, tag);
+        }
+
+        template <class RACursor, class KeyFunction, class Key>
+        void radix_sort(RACursor cur, KeyFunction & key, declare_type<Key>,
+                        std::false_type)
+        {
+            details::msd_radix_sort(cur, 0*cur.size(), cur.size(),
+                                    std::size_t{0}, key);
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    /** @ingroup SortingOperations
+    @brief Тип функционального объекта для поразрядной сортировки
+    */
+    class radix_sort_fn
+    {
+    public:
+        /** @brief Поразрядная сортировка
+        @details Элементы упорядочиваются по возрастанию ключей
+        <tt> key(x) </tt>. Ключами могут быть целые числа, перечисления
+        (упорядочиваются как значения базового типа), числа с плавающей
+        точкой (отрицательные числа предшествуют положительным, -0.0
+        предшествует +0.0) или строки, которые сравниваются
+        лексикографически как последовательности байтов без знака.
+
+        Для числовых ключей используется сортировка от младших разрядов со
+        сложностью <tt> O(N) </tt>, она устойчива и требует буфера на
+        @c N элементов; если его не удаётся выделить, то используется
+        устойчивая сортировка слиянием. Для строк используется сортировка от
+        старших разрядов без дополнительной памяти, которая не является
+        устойчивой.
+        @param s сортируемая последовательность
+        @param key функция, вычисляющая ключ элемента, по умолчанию
+        ключом является сам элемент.
+        @return Последовательность, полученная из @c s путём продвижения до
+        исчерпания.
+        */
+        template <class RASequence, class KeyFunction = details::radix_identity_key>
+        cursor_type_t<RASequence>
+        operator()(RASequence && s, KeyFunction key = KeyFunction()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Permutable<cursor_type_t<RASequence>>));
+
+            return this->impl(::ural::cursor_fwd<RASequence>(s),
+                              ::ural::make_callable(std::move(key)));
+        }
+
+    private:
+        template <class RACursor, class KeyFunction>
+        static RACursor impl(RACursor cur, KeyFunction key)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+            BOOST_CONCEPT_ASSERT((concepts::Permutable<RACursor>));
+
+            using Key = typename std::decay<decltype(key(*cur))>::type;
+            using Numeric = std::integral_constant<bool, std::is_arithmetic<Key>::value
+                                                         || std::is_enum<Key>::value>;
+
+            if(cur.size() > 1)
+            {
+                details::radix_sort(cur, key, declare_type<Key>{}, Numeric{});
+            }
+
+            cur += cur.size();
+            return cur;
+        }
+    };
+
+    /** @ingroup SortingOperations
     @brief Тип функционального объекта для определение N-го элемента
     сортированной последовательности.
     */
@@ -811,16 +2820,21 @@ inline namespace v1
         Кроме того, элементы передней пройденной части последовательности
         становятся оказываются меньшими, чем элементы непройденной части
         последовательности.
+
+        Используется интроспективный выбор: быстрый выбор с опорным элементом,
+        как в @c sort_fn, который при превышении глубины <tt> 2 log(N) </tt>
+        переходит к выбору по медиане медиан. Сложность линейная в среднем и
+        в худшем случае.
         @param s последовательность
         @param cmp функция сравнения, по умолчанию используется
         <tt> less<> </tt>, то есть оператор "меньше".
         @return Последовательность, полученная из
         <tt> ::ural::cursor_fwd<RASequence>(s) </tt>, продвижением до
         исчерпания.
-        @todo перегрузка, получающая номер элемента
         */
         template <class RASequence, class Compare = ::ural::less<>>
-        cursor_type_t<RASequence>
+        typename std::enable_if<!std::is_integral<Compare>::value,
+                                cursor_type_t<RASequence>>::type
         operator()(RASequence && s, Compare cmp = Compare()) const
         {
             BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
@@ -830,6 +2844,36 @@ inline namespace v1
                               ::ural::make_callable(std::move(cmp)));
         }
 
+        /** @brief Определение N-го элемента сортированной последовательности
+        @details Эквивалентно <tt> (*this)(::ural::cursor_fwd<RASequence>(s) + nth, cmp) </tt>
+        @param s последовательность
+        @param nth номер элемента, отсчитываемый от начала непройденной части
+        <tt> ::ural::cursor_fwd<RASequence>(s) </tt>
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @pre <tt> 0 <= nth && nth <= ::ural::cursor_fwd<RASequence>(s).size() </tt>
+        @return Последовательность, полученная из
+        <tt> ::ural::cursor_fwd<RASequence>(s) </tt>, продвижением до
+        исчерпания.
+        */
+        template <class RASequence, class Compare = ::ural::less<>>
+        cursor_type_t<RASequence>
+        operator()(RASequence && s,
+                   difference_type_t<cursor_type_t<RASequence>> nth,
+                   Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            auto cur = ::ural::cursor_fwd<RASequence>(s);
+
+            assert(0 <= nth && nth <= cur.size());
+            cur += nth;
+
+            return this->impl(std::move(cur),
+                              ::ural::make_callable(std::move(cmp)));
+        }
+
     private:
         template <class RACursor, class Compare>
         static RACursor impl(RACursor cur, Compare cmp)
@@ -837,10 +2881,136 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
             BOOST_CONCEPT_ASSERT((concepts::Sortable<RACursor, Compare>));
 
-            return heap_select_fn{}(std::move(cur), std::move(cmp));
+            auto const nth = cur.traversed_front().size();
+
+            cur += cur.size();
+            auto whole = cur.traversed_front();
+
+            auto const n = whole.size();
+
+            if(nth < n)
+            {
+                details::introselect(whole, 0*n, n, nth,
+                                     2 * details::floor_log2(n), cmp);
+            }
+
+            return cur;
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        /* Бинарный поиск без ветвлений применяется к курсорам произвольного
+        доступа, ссылающимся на элементы арифметических типов, если сравнение
+        выполняется встроенными операторами: выбор половины тогда сводится к
+        условной пересылке, а элементы следующего шага можно заранее
+        загрузить в кэш.
+        */
+        template <class RACursor, class Compare, class T>
+        struct is_branchless_search
+         : std::integral_constant<bool, is_branchless_comparison<Compare, value_type_t<RACursor>>::value
+                                        && std::is_arithmetic<T>::value
+                                        && std::is_lvalue_reference<reference_type_t<RACursor>>::value>
+        {};
+
+        template <class RACursor>
+        void prefetch_element(RACursor const & cur, difference_type_t<RACursor> i,
+                              std::true_type)
+        {
+        #if defined(__GNUC__)
+            __builtin_prefetch(std::addressof(cur[i]));
+        #else
+            (void)cur;
+            (void)i;
+        #endif
+        }
+
+        template <class RACursor>
+        void prefetch_element(RACursor const &, difference_type_t<RACursor>,
+                              std::false_type)
+        {}
+
+        /* Возвращает индекс первого элемента из [0, n), для которого pred
+        возвращает false.
+        */
+        template <class RACursor, class Predicate>
+        difference_type_t<RACursor>
+        partition_point_index(RACursor const & cur, difference_type_t<RACursor> n,
+                              Predicate & pred, std::false_type)
+        {
+            auto first = 0*n;
+
+            while(n > 0)
+            {
+                auto const half = n / 2;
+
+                if(pred(cur[first + half]))
+                {
+                    first += half + 1;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+
+            return first;
+        }
+
+        template <class RACursor, class Predicate>
+        difference_type_t<RACursor>
+        partition_point_index(RACursor const & cur, difference_type_t<RACursor> n,
+                              Predicate & pred, std::true_type)
+        {
+            if(n == 0)
+            {
+                return n;
+            }
+
+            auto base = 0*n;
+
+            // Длина интервала уменьшается независимо от результата сравнения,
+            // поэтому заранее известны оба кандидата на следующую проверку
+            while(n > 1)
+            {
+                auto const half = n / 2;
+                auto const next = (n - half) / 2;
+
+                details::prefetch_element(cur, base + next, std::true_type{});
+                details::prefetch_element(cur, base + half + next, std::true_type{});
+
+                base = pred(cur[base + half]) ? base + half : base;
+                n -= half;
+            }
+
+            return base + (pred(cur[base]) ? 1 : 0);
+        }
+
+        template <class Forward, class Predicate, class Branchless>
+        Forward bisect(Forward in, Predicate pred, Branchless, forward_cursor_tag)
+        {
+            return ::ural::partition_point_fn{}(std::move(in), std::move(pred));
+        }
+
+        template <class RACursor, class Predicate, class Branchless>
+        RACursor bisect(RACursor in, Predicate pred, Branchless,
+                        finite_random_access_cursor_tag)
+        {
+            in.shrink_front();
+            auto const n = in.size();
+
+            in += details::partition_point_index(in, n, pred, Branchless{});
+
+            return in;
+        }
+
+        constexpr std::size_t lower_bound_many_batch = 16;
+    }
+    // namespace details
+    /// @endcond
+
     /** @ingroup BinarySearch
     @brief Тип функционального объекта для поиска нижней грани
     */
@@ -878,8 +3048,11 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, T const *, Forward>));
 
+            using Branchless = details::is_branchless_search<Forward, Compare, T>;
+
             auto pred = [&](auto const & x) { return cmp(x, value); };
-            return ::ural::partition_point_fn{}(std::move(in), std::move(pred));
+            return details::bisect(std::move(in), std::move(pred), Branchless{},
+                                   ::ural::make_cursor_tag(in));
         }
     };
 
@@ -921,9 +3094,122 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<RACursor>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, T const *, RACursor>));
 
+            using Branchless = details::is_branchless_search<RACursor, Compare, T>;
+
             auto pred = [&](auto const & x) { return !cmp(value, x); };
 
-            return ::ural::partition_point_fn{}(std::move(in), std::move(pred));
+            return details::bisect(std::move(in), std::move(pred), Branchless{},
+                                   ::ural::make_cursor_tag(in));
+        }
+    };
+
+    /** @ingroup BinarySearch
+    @brief Тип функционального объекта для поиска нижних граней нескольких
+    значений
+    */
+    class lower_bound_many_fn
+    {
+    public:
+        /** Поиски выполняются группами по несколько значений: шаги бинарного
+        поиска разных значений чередуются, поэтому задержки обращения к памяти
+        перекрываются.
+        @brief Поиск нижних граней для последовательности значений
+        @param in последовательность
+        @param values последовательность искомых значений
+        @param out выходная последовательность, в которую записываются индексы
+        нижних граней, то есть <tt> lower_bound(in, v, cmp).traversed_front().size() </tt>
+        для каждого значения @c v из @c values
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше"
+        @pre Элементы @c e последовательности @c in должны быть разделены
+        относительно предиката <tt> cmp(e, v) </tt> для каждого @c v из
+        @c values.
+        @return Кортеж, содержащий непройденные части последовательностей
+        значений и выходной последовательности.
+        */
+        template <class RASequence, class Forward, class Output,
+                  class Compare = ::ural::less<>>
+        tuple<cursor_type_t<Forward>, cursor_type_t<Output>>
+        operator()(RASequence && in, Forward && values, Output && out,
+                   Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward>));
+            BOOST_CONCEPT_ASSERT((concepts::SinglePassSequence<Output>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare,
+                                                             cursor_type_t<RASequence>,
+                                                             cursor_type_t<Forward>>));
+
+            return this->impl(::ural::cursor_fwd<RASequence>(in),
+                              ::ural::cursor_fwd<Forward>(values),
+                              ::ural::cursor_fwd<Output>(out),
+                              ::ural::make_callable(std::move(cmp)));
+        }
+
+    private:
+        template <class RACursor, class Forward, class Output, class Compare>
+        static tuple<Forward, Output>
+        impl(RACursor in, Forward values, Output out, Compare cmp)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessCursor<RACursor>));
+            BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
+            BOOST_CONCEPT_ASSERT((concepts::SinglePassCursor<Output>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, RACursor, Forward>));
+
+            using Branchless = details::is_branchless_search<RACursor, Compare,
+                                                             value_type_t<Forward>>;
+            using Difference = difference_type_t<RACursor>;
+
+            in.shrink_front();
+            auto const n = in.size();
+
+            Difference base[details::lower_bound_many_batch];
+
+            while(!!values && !!out)
+            {
+                auto batch = values;
+                std::size_t m = 0;
+
+                for(; m != details::lower_bound_many_batch && !!values; ++ values)
+                {
+                    base[m] = 0*n;
+                    ++ m;
+                }
+
+                for(auto len = n; len > 1;)
+                {
+                    auto const half = len / 2;
+                    len -= half;
+
+                    auto v = batch;
+                    for(std::size_t k = 0; k != m; ++ k, (void) ++ v)
+                    {
+                        base[k] = cmp(in[base[k] + half], *v) ? base[k] + half : base[k];
+                        details::prefetch_element(in, base[k] + len / 2, Branchless{});
+                    }
+                }
+
+                if(n > 0)
+                {
+                    auto v = batch;
+                    for(std::size_t k = 0; k != m; ++ k, (void) ++ v)
+                    {
+                        base[k] += cmp(in[base[k]], *v) ? 1 : 0;
+                    }
+                }
+
+                for(std::size_t k = 0; k != m; ++ k, (void) ++ batch, ++ out)
+                {
+                    if(!out)
+                    {
+                        return tuple<Forward, Output>(std::move(batch), std::move(out));
+                    }
+
+                    *out = base[k];
+                }
+            }
+
+            return tuple<Forward, Output>(std::move(values), std::move(out));
         }
     };
 
@@ -1076,17 +3362,174 @@ inline namespace v1
                                                       cursor_type_t<Output>,
                                                       Compare>));
 
-            auto inputs = ::ural::experimental::merged(::ural::cursor_fwd<Input1>(in1),
-                                                       ::ural::cursor_fwd<Input2>(in2),
-                                                       ::ural::make_callable(std::move(cmp)));
-            auto result = ural::copy_fn{}(std::move(inputs),
-                                          ::ural::cursor_fwd<Output>(out));
+            auto inputs = ::ural::experimental::merged(::ural::cursor_fwd<Input1>(in1),
+                                                       ::ural::cursor_fwd<Input2>(in2),
+                                                       ::ural::make_callable(std::move(cmp)));
+            auto result = ural::copy_fn{}(std::move(inputs),
+                                          ::ural::cursor_fwd<Output>(out));
+
+            return ural::make_tuple(std::move(result[ural::_1]).first_base(),
+                                    std::move(result[ural::_1]).second_base(),
+                                    std::move(result[ural::_2]));
+        }
+    };
+
+    /** @ingroup SetOperations
+    @brief Тип функционального объекта для слияния произвольного количества
+    сортированных последовательностей.
+    */
+    class k_merge_fn
+    {
+    public:
+        /** Для выбора очередного элемента используется дерево проигравших
+        (смотри @c k_merge_cursor), поэтому на каждый элемент требуется
+        <tt> log2(k) </tt> сравнений, где @c k --- количество входных
+        последовательностей. Слияние устойчиво: из эквивалентных элементов
+        первым записывается элемент последовательности, которая идёт раньше
+        в @c ins.
+        @brief Слияние нескольких последовательностей путём копирования в
+        выходную последовательность
+        @param ins последовательность входных последовательностей
+        @param out выходная последовательность
+        @param cmp функция сравнения, по умолчанию используется
+        <tt> less<> </tt>, то есть оператор "меньше".
+        @return Кортеж, содержащий массив курсоров непройденных частей входных
+        последовательностей и непройденную часть выходной последовательности.
+        */
+        template <class Inputs, class Output, class Compare = ::ural::less<>>
+        auto operator()(Inputs && ins, Output && out,
+                        Compare cmp = Compare()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::InputSequence<Inputs>));
+            BOOST_CONCEPT_ASSERT((concepts::SinglePassSequence<Output>));
+
+            auto inputs = ::ural::experimental::k_merged(std::forward<Inputs>(ins),
+                                                         std::move(cmp));
+
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<decltype(inputs),
+                                                               cursor_type_t<Output>>));
+
+            auto result = ural::copy_fn{}(std::move(inputs),
+                                          ::ural::cursor_fwd<Output>(out));
+
+            return ural::make_tuple(std::move(result[ural::_1]).bases(),
+                                    std::move(result[ural::_2]));
+        }
+    };
+
+    /// @cond false
+    namespace details
+    {
+        /* Слияние соседних упорядоченных курсоров cur1 и cur2: cur1
+        перемещается в буфер, затем результат записывается от начала cur1.
+        */
+        template <class Cursor1, class Cursor2, class Compare, class Buffer>
+        void buffered_merge_forward(Cursor1 cur1, Cursor2 cur2,
+                                    Compare & cmp, Buffer & buffer)
+        {
+            std::ptrdiff_t n1 = 0;
+            for(auto in = cur1; !!in; ++ in, ++ n1)
+            {
+                buffer.push_back(std::move(*in));
+            }
+
+            auto out1 = cur1;
+            auto out2 = cur2;
+
+            auto put = [&](auto && x)
+            {
+                if(!!out1)
+                {
+                    *out1 = std::forward<decltype(x)>(x);
+                    ++ out1;
+                }
+                else
+                {
+                    *out2 = std::forward<decltype(x)>(x);
+                    ++ out2;
+                }
+            };
+
+            std::ptrdiff_t i = 0;
+
+            for(auto in2 = cur2; i != n1 && !!in2;)
+            {
+                if(cmp(*in2, buffer[i]))
+                {
+                    put(std::move(*in2));
+                    ++ in2;
+                }
+                else
+                {
+                    put(std::move(buffer[i]));
+                    ++ i;
+                }
+            }
+
+            for(; i != n1; ++ i)
+            {
+                put(std::move(buffer[i]));
+            }
+
+            buffer.clear();
+        }
+
+        /* Слияние соседних упорядоченных курсоров cur1 и cur2: cur2
+        перемещается в буфер, затем результат записывается от конца cur2.
+        */
+        template <class Cursor1, class Cursor2, class Compare, class Buffer>
+        void buffered_merge_backward(Cursor1 cur1, Cursor2 cur2,
+                                     Compare & cmp, Buffer & buffer)
+        {
+            std::ptrdiff_t n2 = 0;
+            for(auto in = cur2; !!in; ++ in, ++ n2)
+            {
+                buffer.push_back(std::move(*in));
+            }
+
+            auto out1 = cur1;
+            auto out2 = cur2;
 
-            return ural::make_tuple(std::move(result[ural::_1]).first_base(),
-                                    std::move(result[ural::_1]).second_base(),
-                                    std::move(result[ural::_2]));
+            auto put = [&](auto && x)
+            {
+                if(!!out2)
+                {
+                    out2.back() = std::forward<decltype(x)>(x);
+                    out2.pop_back();
+                }
+                else
+                {
+                    out1.back() = std::forward<decltype(x)>(x);
+                    out1.pop_back();
+                }
+            };
+
+            auto j = n2;
+
+            for(auto in1 = cur1; j != 0 && !!in1;)
+            {
+                if(cmp(buffer[j-1], in1.back()))
+                {
+                    put(std::move(in1.back()));
+                    in1.pop_back();
+                }
+                else
+                {
+                    put(std::move(buffer[j-1]));
+                    -- j;
+                }
+            }
+
+            for(; j != 0; -- j)
+            {
+                put(std::move(buffer[j-1]));
+            }
+
+            buffer.clear();
         }
-    };
+    }
+    // namespace details
+    /// @endcond
 
     /** @ingroup SetOperations
     @brief Тип функционального объекта для слияния сортированных частей
@@ -1097,6 +3540,10 @@ inline namespace v1
     public:
         /** @brief Слияние передней пройденной и непройденной части
         последовательности.
+        @details Меньшая из частей перемещается во временный буфер, после чего
+        слияние выполняется за линейное время. Если выделить буфер не удаётся,
+        то используется слияние без дополнительной памяти с помощью поворотов,
+        требующее <tt> O(N log N) </tt> перемещений.
         @param s последовательность
         @param cmp функция сравнения, по умолчанию используется
         <tt> less<> </tt>, то есть оператор "меньше".
@@ -1113,15 +3560,64 @@ inline namespace v1
 
             // @todo Возвращать из impl последовательность
             auto seq = ::ural::cursor_fwd<Bidirectional>(s);
-            this->impl(seq, ::ural::make_callable(std::move(cmp)));
+            auto f_cmp = ::ural::make_callable(std::move(cmp));
+
+            using Value = value_type_t<cursor_type_t<Bidirectional>>;
+
+            auto const cur1 = seq.traversed_front();
+            auto const cur2 = ural::shrink_front_copy(seq);
+
+            // Уже слитые части не требуют буфера
+            if(!!cur1 && !!cur2 && f_cmp(*cur2, cur1.back()))
+            {
+                auto const n1 = ural::size(cur1);
+                auto const n2 = ural::size(cur2);
+
+                details::temporary_buffer<Value> buffer(std::min(n1, n2));
+                this->impl(seq, f_cmp, buffer);
+            }
+
+            seq.exhaust_front();
+            return seq;
+        }
+
+        /** @brief Слияние передней пройденной и непройденной части
+        последовательности с использованием заданного буфера.
+        @details В отличие от варианта без буфера, память не выделяется.
+        Если размер @c scratch не меньше, чем размер меньшей из частей, то
+        слияние выполняется за линейное время.
+        @param s последовательность
+        @param cmp функция сравнения
+        @param scratch последовательность, элементы которой используются
+        для временного хранения элементов @c s. После завершения работы их
+        значения не определены.
+        @return Последовательность, полученная
+        <tt>::ural::cursor_fwd<Bidirectional>(seq)</tt> путём продвижения до
+        исчерпания.
+        */
+        template <class Bidirectional, class Compare, class RASequence>
+        cursor_type_t<Bidirectional>
+        operator()(Bidirectional && s, Compare cmp, RASequence && scratch) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::BidirectionalSequence<Bidirectional>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<Bidirectional>, Compare>));
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+
+            auto seq = ::ural::cursor_fwd<Bidirectional>(s);
+            auto f_cmp = ::ural::make_callable(std::move(cmp));
+
+            using Scratch = details::cursor_scratch<cursor_type_t<RASequence>>;
+            Scratch buffer(::ural::cursor_fwd<RASequence>(scratch));
+
+            this->impl(seq, f_cmp, buffer);
 
             seq.exhaust_front();
             return seq;
         }
 
     private:
-        template <class BidirectionalCursor, class Compare>
-        void impl(BidirectionalCursor cur, Compare cmp) const
+        template <class BidirectionalCursor, class Compare, class Buffer>
+        void impl(BidirectionalCursor cur, Compare & cmp, Buffer & buffer) const
         {
             BOOST_CONCEPT_ASSERT((concepts::BidirectionalCursor<BidirectionalCursor>));
             BOOST_CONCEPT_ASSERT((concepts::Sortable<BidirectionalCursor, Compare>));
@@ -1140,6 +3636,23 @@ inline namespace v1
             assert(::ural::is_sorted_fn{}(cur1, cmp));
             assert(::ural::is_sorted_fn{}(cur2, cmp));
 
+            if(!cmp(*cur2, cur1.back()))
+            {
+                return;
+            }
+
+            if(n1 <= n2 && n1 <= buffer.capacity())
+            {
+                details::buffered_merge_forward(cur1, cur2, cmp, buffer);
+                return;
+            }
+
+            if(n2 < n1 && n2 <= buffer.capacity())
+            {
+                details::buffered_merge_backward(cur1, cur2, cmp, buffer);
+                return;
+            }
+
             if(n1 + n2 == 2)
             {
                 if(cmp(*cur2, *cur1))
@@ -1163,14 +3676,19 @@ inline namespace v1
                 cur1_cut = upper_bound_fn{}(cur1, *cur2_cut, cmp);
             }
 
-            ::ural::rotate_fn{}(cur1_cut, cur2_cut.traversed_front());
-
-            auto cur_new = cur.original();
-
             auto n11 = ural::size(cur1_cut.traversed_front());
             auto n12 = ural::size(cur1_cut);
             auto n21 = ural::size(cur2_cut.traversed_front());
 
+            // Поворот одной последовательности не использует рекурсию
+            auto cur_rotate = ural::shrink_front_copy(ural::next(cur.original(), n11));
+            ural::pop_back_n(cur_rotate, ural::size(cur_rotate) - (n12 + n21));
+            ural::advance(cur_rotate, n12);
+
+            ::ural::rotate_fn{}(std::move(cur_rotate));
+
+            auto cur_new = cur.original();
+
             ural::advance(cur_new, n11 + n21);
 
             auto cur1_new = cur_new.traversed_front();
@@ -1179,11 +3697,47 @@ inline namespace v1
             ural::advance(cur1_new, n11);
             ural::advance(cur2_new, n12);
 
-            this->impl(cur1_new, cmp);
-            this->impl(cur2_new, cmp);
+            this->impl(cur1_new, cmp, buffer);
+            this->impl(cur2_new, cmp, buffer);
         }
     };
 
+    /// @cond false
+    namespace details
+    {
+        template <class RACursor, class Compare, class T>
+        void merge_with_scratch(RACursor cur,
+                                difference_type_t<RACursor> first,
+                                difference_type_t<RACursor> middle,
+                                difference_type_t<RACursor> last,
+                                Compare & cmp, temporary_buffer<T> & buffer)
+        {
+            using Index = difference_type_t<RACursor>;
+
+            auto const n = std::min(middle - first, Index(buffer.capacity()));
+
+            // Рабочая память должна состоять из созданных элементов: создаём
+            // их перемещением из cur и сразу возвращаем значения на место
+            buffer.move_from(cur, first, n);
+
+            for(Index i = 0; i != n; ++ i)
+            {
+                cur[first + i] = std::move(buffer[i]);
+            }
+
+            auto sub = details::random_access_subcursor(cur, first, last);
+            sub += (middle - first);
+
+            ::ural::inplace_merge_fn{}(std::move(sub), cmp,
+                                       ::ural::iterator_cursor<T *>(buffer.data(),
+                                                                    buffer.data() + n));
+
+            buffer.clear();
+        }
+    }
+    // namespace details
+    /// @endcond
+
     // Операции с множествами
     /** @ingroup SetOperations
     @brief Тип функционального объекта для проверки того, что одно множество
@@ -1228,7 +3782,7 @@ inline namespace v1
             {
                 if(cmp(*in1, *in2))
                 {
-                    ++ in1;
+                    ::ural::experimental::details::gallop_to(in1, *in2, cmp);
                 }
                 else if(cmp(*in2, *in1))
                 {
@@ -1689,6 +4243,22 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, Forward>));
 
+            using Contiguous = details::use_contiguous_ordering<Forward, Compare>;
+
+            return min_element_fn::impl(std::move(in), std::move(cmp), Contiguous{});
+        }
+
+        template <class Forward, class Compare>
+        static Forward
+        impl(Forward in, Compare, std::true_type)
+        {
+            return details::contiguous_minmax_element<true, false>(std::move(in))[ural::_1];
+        }
+
+        template <class Forward, class Compare>
+        static Forward
+        impl(Forward in, Compare cmp, std::false_type)
+        {
             if(!in)
             {
                 return in;
@@ -1744,6 +4314,22 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, Forward>));
 
+            using Contiguous = details::use_contiguous_ordering<Forward, Compare>;
+
+            return max_element_fn::impl(std::move(in), std::move(cmp), Contiguous{});
+        }
+
+        template <class Forward, class Compare>
+        static Forward
+        impl(Forward in, Compare, std::true_type)
+        {
+            return details::contiguous_minmax_element<false, true>(std::move(in))[ural::_2];
+        }
+
+        template <class Forward, class Compare>
+        static Forward
+        impl(Forward in, Compare cmp, std::false_type)
+        {
             auto transposed_cmp = ::ural::experimental::make_binary_reverse_args(std::move(cmp));
 
             return ::ural::min_element_fn{}(std::move(in),
@@ -1812,6 +4398,27 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, Forward>));
 
+            using Contiguous = details::use_contiguous_ordering<Forward, Compare>;
+
+            return minmax_element_fn::impl(std::move(in), std::move(cmp), Contiguous{});
+        }
+
+        template <class Forward, class Compare>
+        static tuple<Forward, Forward>
+        impl(Forward in, Compare, std::true_type)
+        {
+            return details::contiguous_minmax_element<true, true>(std::move(in));
+        }
+
+        /* Элементы обрабатываются парами: сначала они сравниваются между
+        собой, затем меньший из них сравнивается с текущим наименьшим, а
+        больший --- с текущим наибольшим. Всего выполняется не более 3n/2
+        сравнений.
+        */
+        template <class Forward, class Compare>
+        static tuple<Forward, Forward>
+        impl(Forward in, Compare cmp, std::false_type)
+        {
             using Tuple = tuple<Forward, Forward>;
 
             if(!in)
@@ -1819,16 +4426,17 @@ inline namespace v1
                 return Tuple{in, in};
             }
 
-            auto cmp_min = ::ural::experimental::compare_by(::ural::experimental::dereference<>{}, std::cref(cmp));
-            auto cmp_max = ::ural::experimental::make_binary_reverse_args(cmp_min);
-
-            ::ural::experimental::min_element_accumulator<Forward, decltype(cmp_min)>
-                acc_min(in, std::move(cmp_min));
-            ::ural::experimental::min_element_accumulator<Forward, decltype(cmp_max)>
-                acc_max(in, std::move(cmp_max));
+            auto min_pos = in;
+            auto max_pos = in;
             ++ in;
 
-            for(; !!in; ++ in)
+            /* Если наибольший элемент был взят вторым из пары, то первый из
+            неё может быть ему эквивалентен: это проверяется один раз в конце.
+            */
+            auto max_prev = max_pos;
+            bool max_tied = false;
+
+            while(!!in)
             {
                 auto in_next = in;
                 ++ in_next;
@@ -1836,29 +4444,56 @@ inline namespace v1
                 // остался только один элемент
                 if(!in_next)
                 {
-                    if(acc_min.update(in) == false)
+                    if(cmp(*in, *min_pos))
                     {
-                        acc_max(in);
+                        min_pos = in;
+                    }
+                    else if(cmp(*max_pos, *in))
+                    {
+                        max_pos = in;
+                        max_tied = false;
                     }
                     break;
                 }
 
                 // осталось как минимум два элемента
-                if(cmp(*in, *in_next))
+                if(cmp(*in_next, *in))
                 {
-                    acc_min(in);
-                    acc_max(in_next);
+                    if(cmp(*in_next, *min_pos))
+                    {
+                        min_pos = in_next;
+                    }
+                    if(cmp(*max_pos, *in))
+                    {
+                        max_pos = in;
+                        max_tied = false;
+                    }
                 }
                 else
                 {
-                    acc_min(in_next);
-                    acc_max(in);
+                    if(cmp(*in, *min_pos))
+                    {
+                        min_pos = in;
+                    }
+                    if(cmp(*max_pos, *in_next))
+                    {
+                        max_prev = in;
+                        max_pos = in_next;
+                        max_tied = true;
+                    }
                 }
 
-                in = in_next;
+                in = std::move(in_next);
+                ++ in;
+            }
+
+            // из двух равных наибольших выбирается первый
+            if(max_tied && !cmp(*max_prev, *max_pos))
+            {
+                max_pos = std::move(max_prev);
             }
 
-            return Tuple{acc_min.result(), acc_max.result()};
+            return Tuple{std::move(min_pos), std::move(max_pos)};
         }
     };
 
@@ -1902,6 +4537,23 @@ inline namespace v1
             BOOST_CONCEPT_ASSERT((concepts::InputCursor<Input2>));
             BOOST_CONCEPT_ASSERT((concepts::IndirectRelation<Compare, Input1, Input2>));
 
+            using Contiguous = details::use_contiguous_lexicographical_compare<Input1, Input2, Compare>;
+
+            return lexicographical_compare_fn::impl(std::move(in1), std::move(in2),
+                                                    std::move(cmp), Contiguous{});
+        }
+
+        template <class Input1, class  Input2, class Compare>
+        static bool
+        impl(Input1 in1, Input2 in2, Compare, std::true_type)
+        {
+            return details::contiguous_lexicographical_compare(in1, in2);
+        }
+
+        template <class Input1, class  Input2, class Compare>
+        static bool
+        impl(Input1 in1, Input2 in2, Compare cmp, std::false_type)
+        {
             for(; !!in1 && !!in2; ++ in1, (void) ++ in2)
             {
                 if(cmp(*in1, *in2))
@@ -1918,6 +4570,297 @@ inline namespace v1
     };
 
     // Перестановки
+    /// @cond false
+    namespace details
+    {
+        template <class T>
+        struct has_consistent_less
+         : std::integral_constant<bool, std::is_integral<T>::value
+                                        || std::is_enum<T>::value
+                                        || std::is_pointer<T>::value>
+        {};
+
+        template <class Char, class Traits, class Alloc>
+        struct has_consistent_less<std::basic_string<Char, Traits, Alloc>>
+         : std::true_type
+        {};
+
+        template <class T, class = void>
+        struct has_std_hash
+         : std::false_type
+        {};
+
+        template <class T>
+        struct has_std_hash<T, decltype((void)std::hash<T>{}(std::declval<T const &>()))>
+         : std::true_type
+        {};
+
+        struct permutation_by_counting_tag {};
+        struct permutation_by_sorting_tag {};
+        struct permutation_by_hashing_tag {};
+
+        /* Для операции "равно" способ проверки выбирается по типу элементов:
+        если оператор "меньше" согласован с оператором "равно", то сравниваются
+        упорядоченные копии, если есть хэш-функция --- подсчитываются
+        элементы в хэш-таблице.
+        */
+        template <class Forward1, class Forward2, class BinaryPredicate,
+                  class Value = value_type_t<Forward1>,
+                  bool = std::is_same<BinaryPredicate, ::ural::equal_to<>>::value
+                         && std::is_same<Value, value_type_t<Forward2>>::value>
+        struct is_permutation_strategy
+        {
+            using type = permutation_by_counting_tag;
+        };
+
+        template <class Forward1, class Forward2, class BinaryPredicate, class Value>
+        struct is_permutation_strategy<Forward1, Forward2, BinaryPredicate, Value, true>
+        {
+            using type
+                = typename std::conditional<has_consistent_less<Value>::value,
+                                            permutation_by_sorting_tag,
+                  typename std::conditional<has_std_hash<Value>::value,
+                                            permutation_by_hashing_tag,
+                                            permutation_by_counting_tag>::type>::type;
+        };
+    }
+    // namespace details
+    /// @endcond
+
+    /** @ingroup NonModifyingSequenceOperations
+    @brief Функциональный объект для проверки того, что одна последовательность
+    является перестановкой другой
+    */
+    class is_permutation_fn
+    {
+    public:
+        /** Если @c pred --- это <tt> equal_to<> </tt>, а элементы
+        последовательностей имеют одинаковый тип, то способ проверки
+        выбирается автоматически. Для целых чисел, перечислений, указателей
+        и строк сравниваются упорядоченные копии последовательностей, что
+        требует <tt> O(N log(N)) </tt> операций. Для других типов, у которых
+        есть специализация @c std::hash, элементы подсчитываются с помощью
+        хэш-таблицы за линейное в среднем время. В остальных случаях
+        используется алгоритм, выполняющий <tt> O(N^2) </tt> сравнений и не
+        требующий дополнительной памяти.
+        @brief Проверка того, что одна последовательность являются
+        перестановкой другой.
+        @param s1, s2 прямые последовательности
+        @param pred бинарный предикат
+        @return @b true, если для каждого элемента @c s1 существует эквивалентый
+        в смысле @c pred элемент @c s2.
+        */
+        template <class Forward1, class Forward2,
+                  class BinaryPredicate = ::ural::equal_to<>>
+        bool operator()(Forward1 && s1, Forward2 && s2,
+                        BinaryPredicate pred = BinaryPredicate()) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward1>));
+            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward2>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyComparable<cursor_type_t<Forward1>,
+                                                                 cursor_type_t<Forward2>,
+                                                                 BinaryPredicate>));
+
+            return this->impl(::ural::cursor_fwd<Forward1>(s1),
+                              ::ural::cursor_fwd<Forward2>(s2),
+                              ::ural::make_callable(std::move(pred)));
+        }
+
+        /** Копии последовательностей упорядочиваются в буфере, предоставленном
+        вызывающей стороной, поэтому память не выделяется. Если размер буфера
+        меньше суммы длин последовательностей (без учёта общего префикса), то
+        используется алгоритм, выполняющий <tt> O(N^2) </tt> сравнений.
+        @brief Проверка того, что одна последовательность являются
+        перестановкой другой, с использованием буфера
+        @param s1, s2 прямые последовательности
+        @param buffer последовательность произвольного доступа, используемая
+        для хранения упорядоченных копий элементов @c s1 и @c s2
+        @param cmp функция сравнения, задающая строгий слабый порядок
+        @return @b true, если для каждого элемента @c s1 существует
+        эквивалентый в смысле @c cmp элемент @c s2.
+        */
+        template <class Forward1, class Forward2, class RASequence,
+                  class Compare>
+        bool operator()(Forward1 && s1, Forward2 && s2, RASequence && buffer,
+                        Compare cmp) const
+        {
+            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward1>));
+            BOOST_CONCEPT_ASSERT((concepts::ForwardSequence<Forward2>));
+            BOOST_CONCEPT_ASSERT((concepts::RandomAccessSequence<RASequence>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<cursor_type_t<Forward1>,
+                                                               cursor_type_t<RASequence>>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyCopyable<cursor_type_t<Forward2>,
+                                                               cursor_type_t<RASequence>>));
+            BOOST_CONCEPT_ASSERT((concepts::Sortable<cursor_type_t<RASequence>, Compare>));
+
+            auto f_cmp = ::ural::make_callable(std::move(cmp));
+            auto equiv = [&f_cmp](auto const & x, auto const & y)
+                         { return !f_cmp(x, y) && !f_cmp(y, x); };
+
+            auto in1 = ::ural::cursor_fwd<Forward1>(s1);
+            auto in2 = ::ural::cursor_fwd<Forward2>(s2);
+
+            if(!is_permutation_fn::strip_common_prefix(in1, in2, equiv))
+            {
+                return false;
+            }
+
+            auto out = ::ural::cursor_fwd<RASequence>(buffer);
+
+            if(out.size() / 2 < ural::size(in1))
+            {
+                return is_permutation_fn::impl(std::move(in1), std::move(in2),
+                                               std::move(equiv),
+                                               details::permutation_by_counting_tag{});
+            }
+
+            return is_permutation_fn::sort_and_compare(std::move(in1), std::move(in2),
+                                                       std::move(out), f_cmp);
+        }
+
+    private:
+        template <class Forward1, class Forward2, class BinaryPredicate>
+        static bool
+        strip_common_prefix(Forward1 & s1, Forward2 & s2, BinaryPredicate const & pred)
+        {
+            std::tie(s1, s2) = ural::mismatch_fn{}(std::move(s1), std::move(s2),
+                                                   pred);
+
+            s1.shrink_front();
+            s2.shrink_front();
+
+            return ural::size(s1) == ural::size(s2);
+        }
+
+        template <class Forward1, class Forward2, class RACursor, class Compare>
+        static bool
+        sort_and_compare(Forward1 s1, Forward2 s2, RACursor out, Compare cmp)
+        {
+            out.shrink_front();
+
+            auto r1 = ::ural::copy_fn{}(std::move(s1), std::move(out))[ural::_2];
+            auto part1 = r1.traversed_front();
+
+            r1.shrink_front();
+
+            auto r2 = ::ural::copy_fn{}(std::move(s2), std::move(r1))[ural::_2];
+            auto part2 = r2.traversed_front();
+
+            ::ural::pdq_sort_fn{}(part1, cmp);
+            ::ural::pdq_sort_fn{}(part2, cmp);
+
+            auto equiv = [&cmp](auto const & x, auto const & y)
+                         { return !cmp(x, y) && !cmp(y, x); };
+
+            return ::ural::equal_fn{}(part1, part2, equiv);
+        }
+
+        template <class Forward1, class Forward2, class BinaryPredicate>
+        static bool
+        impl(Forward1 s1, Forward2 s2, BinaryPredicate pred)
+        {
+            BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward1>));
+            BOOST_CONCEPT_ASSERT((concepts::ForwardCursor<Forward2>));
+            BOOST_CONCEPT_ASSERT((concepts::IndirectlyComparable<Forward1, Forward2, BinaryPredicate>));
+
+            if(!is_permutation_fn::strip_common_prefix(s1, s2, pred))
+            {
+                return false;
+            }
+
+            using Strategy = typename details::is_permutation_strategy<Forward1, Forward2, BinaryPredicate>::type;
+
+            return is_permutation_fn::impl(std::move(s1), std::move(s2),
+                                           std::move(pred), Strategy{});
+        }
+
+        template <class Forward1, class Forward2, class BinaryPredicate>
+        static bool
+        impl(Forward1 s1, Forward2 s2, BinaryPredicate,
+             details::permutation_by_sorting_tag)
+        {
+            typedef value_type_t<Forward1> Value;
+
+            // Элементы создаются копированием, без value-инициализации
+            std::vector<Value> xs;
+            xs.reserve(ural::size(s1));
+
+            for(; !!s1; ++ s1)
+            {
+                xs.push_back(*s1);
+            }
+
+            std::vector<Value> ys;
+            ys.reserve(xs.size());
+
+            for(; !!s2; ++ s2)
+            {
+                ys.push_back(*s2);
+            }
+
+            ::ural::pdq_sort_fn{}(xs);
+            ::ural::pdq_sort_fn{}(ys);
+
+            return ::ural::equal_fn{}(xs, ys);
+        }
+
+        template <class Forward1, class Forward2, class BinaryPredicate>
+        static bool
+        impl(Forward1 s1, Forward2 s2, BinaryPredicate,
+             details::permutation_by_hashing_tag)
+        {
+            typedef value_type_t<Forward1> Value;
+
+            std::unordered_map<Value, difference_type_t<Forward1>> counts;
+            counts.reserve(ural::size(s1));
+
+            for(; !!s1; ++ s1)
+            {
+                ++ counts[*s1];
+            }
+
+            for(; !!s2; ++ s2)
+            {
+                auto pos = counts.find(*s2);
+
+                if(pos == counts.end() || pos->second == 0)
+                {
+                    return false;
+                }
+
+                -- pos->second;
+            }
+
+            return true;
+        }
+
+        template <class Forward1, class Forward2, class BinaryPredicate>
+        static bool
+        impl(Forward1 s1, Forward2 s2, BinaryPredicate pred,
+             details::permutation_by_counting_tag)
+        {
+            for(; !!s1; ++ s1)
+            {
+                // Пропускаем элементы, которые уже встречались
+                if(!!find_fn{}(s1.traversed_front(), *s1, pred))
+                {
+                    continue;
+                }
+
+                auto s = s1;
+                ++ s;
+                auto const n1 = 1 + count_fn{}(s, *s1, pred);
+                auto const n2 = count_fn{}(s2, *s1, pred);
+
+                if(n1 != n2)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
     /** @ingroup PermutationGenerators
     @brief Тип функционального объекта, порождающего лексикографически
     следующей перестановки.
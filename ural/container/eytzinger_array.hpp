@@ -0,0 +1,368 @@
+#ifndef Z_URAL_CONTAINER_EYTZINGER_ARRAY_HPP_INCLUDED
+#define Z_URAL_CONTAINER_EYTZINGER_ARRAY_HPP_INCLUDED
+
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/** @file ural/container/eytzinger_array.hpp
+ @brief Неизменяемый массив, хранящий упорядоченные элементы в порядке обхода
+ неявного двоичного дерева поиска в ширину (схема Эйтцингера).
+*/
+
+#include <ural/container/vector.hpp>
+#include <ural/defs.hpp>
+
+#include <vector>
+
+namespace ural
+{
+namespace experimental
+{
+    /// @cond false
+    namespace details
+    {
+        /* Номер (считая с единицы) вершины, в которой поиск последний раз
+        свернул налево: отбрасываются завершающие единицы и ещё один бит.
+        */
+        template <class Size>
+        Size eytzinger_unwind(Size j)
+        {
+        #if defined(__GNUC__)
+            static_assert(sizeof(Size) <= sizeof(unsigned long long), "");
+            return j >> (__builtin_ctzll(~static_cast<unsigned long long>(j)) + 1);
+        #else
+            while(j & 1)
+            {
+                j >>= 1;
+            }
+
+            return j >> 1;
+        #endif
+        }
+
+        template <class T>
+        void eytzinger_prefetch(T const * p)
+        {
+        #if defined(__GNUC__)
+            __builtin_prefetch(p);
+        #else
+            (void)p;
+        #endif
+        }
+    }
+    // namespace details
+    /// @endcond
+
+    /** Элементы упорядоченной последовательности размещаются так, как если бы
+    они образовывали полное двоичное дерево поиска, хранимое в виде кучи:
+    потомки элемента с индексом @c k имеют индексы <tt> 2*k + 1 </tt> и
+    <tt> 2*k + 2 </tt>. Первые уровни дерева, через которые проходит каждый
+    поиск, оказываются в нескольких соседних строках кэша, а при спуске можно
+    заранее загружать элементы на несколько уровней ниже. Поэтому для больших
+    таблиц, которые создаются один раз, а затем многократно используются для
+    поиска, данный контейнер работает быстрее, чем бинарный поиск в
+    упорядоченном массиве.
+    Итераторы обходят элементы в порядке их хранения, а не по возрастанию.
+    Создать массив можно из любой последовательности с помощью
+    <tt> seq | to_container<eytzinger_array>{} </tt>.
+    @brief Неизменяемый массив для быстрого поиска в упорядоченных данных
+    @tparam T тип элементов
+    @tparam Compare тип функции сравнения
+    @tparam Allocator тип распределителя памяти
+    @tparam Policy стратегия проверок и реакции на ошибки
+    */
+    template <class T,
+              class Compare = use_default,
+              class Allocator = use_default,
+              class Policy = use_default>
+    class eytzinger_array
+    {
+        typedef ural::experimental::vector<T, Allocator, Policy> Data;
+
+    public:
+        friend bool operator==(eytzinger_array const & x,
+                               eytzinger_array const & y)
+        {
+            return ural::equal(x, y);
+        }
+
+        // Типы
+        /// @brief Тип элементов
+        typedef T value_type;
+
+        /// @brief Функция сравнения элементов
+        using value_compare = experimental::defaulted_type_t<Compare, std::less<value_type>>;
+
+        /// @brief Тип распределителя памяти
+        typedef typename Data::allocator_type allocator_type;
+
+        /// @brief Тип ссылки
+        typedef value_type const & reference;
+
+        /// @brief Тип ссылки на константу
+        typedef value_type const & const_reference;
+
+        /// @brief Тип итератора
+        typedef typename Data::const_iterator iterator;
+
+        /// @brief Тип константного итератора
+        typedef typename Data::const_iterator const_iterator;
+
+        /// @brief Тип разности
+        typedef typename Data::difference_type difference_type;
+
+        /// @brief Тип размера
+        typedef typename Data::size_type size_type;
+
+        /// @brief Тип стратегии
+        typedef typename Data::policy_type policy_type;
+
+        // Конструирование, копирование, уничтожение
+        /** @brief Конструктор
+        @param cmp функция сравнения
+        @param a распределитель памяти
+        @post <tt> this->empty() </tt>
+        */
+        explicit eytzinger_array(value_compare const & cmp = value_compare(),
+                                 allocator_type const & a = allocator_type())
+         : members_(cmp, Data(a))
+        {}
+
+        /** @brief Создание массива по последовательности
+        @details Если <tt> [first; last) </tt> не упорядочена относительно
+        @c cmp, то элементы предварительно сортируются, для упорядоченной
+        последовательности выполняется только линейная проверка.
+        @param first итератор, задающий начало последовательности
+        @param last итератор, задающий конец последовательности
+        @param cmp функция сравнения
+        @param a распределитель памяти
+        @post <tt> this->size() == std::distance(first, last) </tt>
+        */
+        template <class InputIterator>
+        eytzinger_array(InputIterator first, InputIterator last,
+                        value_compare const & cmp = value_compare(),
+                        allocator_type const & a = allocator_type())
+         : members_(cmp, Data(a))
+        {
+            Data sorted(std::move(first), std::move(last), a);
+
+            if(!::ural::is_sorted(sorted, this->value_comp()))
+            {
+                ::ural::stable_sort(sorted, this->value_comp());
+            }
+
+            // Номера элементов sorted в порядке хранения: элементы создаются
+            // сразу на своих местах, конструктор без параметров не требуется
+            std::vector<size_type> order(sorted.size());
+
+            size_type pos = 0;
+            eytzinger_array::fill_order(order, pos, 0);
+
+            assert(pos == sorted.size());
+
+            auto & data = this->members_[ural::_2];
+            data.reserve(sorted.size());
+
+            for(auto const i : order)
+            {
+                data.push_back(std::move(sorted[i]));
+            }
+        }
+
+        /** @brief Создание массива по списку инициализации
+        @param values список значений
+        @param cmp функция сравнения
+        @param a распределитель памяти
+        */
+        eytzinger_array(std::initializer_list<value_type> values,
+                        value_compare const & cmp = value_compare(),
+                        allocator_type const & a = allocator_type())
+         : eytzinger_array(values.begin(), values.end(), cmp, a)
+        {}
+
+        /** @brief Распределитель памяти
+        @return Копия распределителя памяти, использованного при создании
+        массива
+        */
+        allocator_type get_allocator() const
+        {
+            return this->members_[ural::_2].get_allocator();
+        }
+
+        // Итераторы
+        /** @brief Итератор начала
+        @return Итератор первого элемента в порядке хранения
+        */
+        const_iterator begin() const noexcept
+        {
+            return this->members_[ural::_2].begin();
+        }
+
+        /** @brief Итератор конца
+        @return Итератор, следующий за последним элементом
+        */
+        const_iterator end() const noexcept
+        {
+            return this->members_[ural::_2].end();
+        }
+
+        // Размер
+        /** @brief Проверка отсутствия элементов
+        @return <tt> this->size() == 0 </tt>
+        */
+        bool empty() const noexcept
+        {
+            return this->members_[ural::_2].empty();
+        }
+
+        /** @brief Количество элементов
+        */
+        size_type size() const noexcept
+        {
+            return this->members_[ural::_2].size();
+        }
+
+        /** @brief Указатель на начало массива элементов
+        */
+        value_type const * data() const noexcept
+        {
+            return this->members_[ural::_2].data();
+        }
+
+        /** @brief Доступ к элементу по индексу в порядке хранения
+        @param k индекс
+        @pre <tt> k < this->size() </tt>
+        */
+        const_reference operator[](size_type k) const
+        {
+            return this->members_[ural::_2][k];
+        }
+
+        // Наблюдатели
+        /** @brief Функция сравнения
+        */
+        value_compare const & value_comp() const
+        {
+            return this->members_[ural::_1];
+        }
+
+        // Поиск
+        /** @brief Поиск нижней грани
+        @param x значение
+        @return Итератор наименьшего элемента @c e, для которого
+        <tt> cmp(e, x) == false </tt>, или <tt> this->end() </tt>, если
+        такого элемента нет.
+        */
+        template <class Key>
+        const_iterator lower_bound(Key const & x) const
+        {
+            auto const & cmp = this->value_comp();
+
+            return this->search([&](value_type const & e) { return cmp(e, x); });
+        }
+
+        /** @brief Поиск верхней грани
+        @param x значение
+        @return Итератор наименьшего элемента @c e, для которого
+        <tt> cmp(x, e) == true </tt>, или <tt> this->end() </tt>, если
+        такого элемента нет.
+        */
+        template <class Key>
+        const_iterator upper_bound(Key const & x) const
+        {
+            auto const & cmp = this->value_comp();
+
+            return this->search([&](value_type const & e) { return !cmp(x, e); });
+        }
+
+        /** @brief Поиск элемента
+        @param x значение
+        @return Итератор элемента, эквивалентного @c x, или
+        <tt> this->end() </tt>, если такого элемента нет.
+        */
+        template <class Key>
+        const_iterator find(Key const & x) const
+        {
+            auto pos = this->lower_bound(x);
+
+            if(pos != this->end() && this->value_comp()(x, *pos))
+            {
+                return this->end();
+            }
+
+            return pos;
+        }
+
+        /** @brief Проверка наличия элемента
+        @param x значение
+        @return @b true, если массив содержит элемент, эквивалентный @c x
+        */
+        template <class Key>
+        bool contains(Key const & x) const
+        {
+            return this->find(x) != this->end();
+        }
+
+    private:
+        static void fill_order(std::vector<size_type> & order, size_type & pos,
+                               size_type k)
+        {
+            if(k < order.size())
+            {
+                eytzinger_array::fill_order(order, pos, 2*k + 1);
+                order[k] = pos;
+                ++ pos;
+                eytzinger_array::fill_order(order, pos, 2*k + 2);
+            }
+        }
+
+        // Вершины нумеруются с единицы: потомки вершины j --- 2*j и 2*j + 1
+        template <class Predicate>
+        const_iterator search(Predicate pred) const
+        {
+            auto const first = this->data();
+            auto const n = this->size();
+
+            // Шестнадцать потомков на четыре уровня ниже
+            constexpr size_type lookahead = 16;
+
+            size_type j = 1;
+
+            while(j <= n)
+            {
+                if(lookahead * j <= n)
+                {
+                    details::eytzinger_prefetch(first + lookahead * j - 1);
+                }
+
+                j = 2*j + (pred(first[j - 1]) ? 1 : 0);
+            }
+
+            j = details::eytzinger_unwind(j);
+
+            return j == 0 ? this->end() : this->begin() + (j - 1);
+        }
+
+    private:
+        tuple<value_compare, Data> members_;
+    };
+}
+// namespace experimental
+}
+// namespace ural
+
+#endif
+// Z_URAL_CONTAINER_EYTZINGER_ARRAY_HPP_INCLUDED
@@ -268,30 +268,47 @@ inline namespace v1
         @param c проверяемый контейнер или последовательность
         @param index проверяемый индекс
         */
+        template <class Container, class Size>
+        static void
+        check_index(Container const &, Size)
+        {}
+
+        template <class Container, class Size>
+        static void
+        check_step(Container const &, Size)
+        {}
+
+        /** @brief Проверяет, что последовательность @c seq не пуста.
+        @param c проверяемый контейнер или последовательность
+        */
         template <class Container>
         static void
-        check_index(Container const & c,
-                    typename Container::difference_type index);
+        check_not_empty(Container const &)
+        {}
 
         /** @brief Проверяет, что последовательность @c seq не пуста.
         @param c проверяемый контейнер или последовательность
         */
         template <class Container>
         static void
-        check_not_empty(Container const & c);
+        assert_not_empty(Container const &)
+        {}
 
         template <class ConstIterator>
-        static void assert_can_erase(ConstIterator first, ConstIterator last,
-                                     ConstIterator q);
+        static void assert_can_erase(ConstIterator, ConstIterator,
+                                     ConstIterator)
+        {}
 
         template <class ConstIterator>
-        static void assert_can_erase(ConstIterator first, ConstIterator last,
-                                     ConstIterator q1, ConstIterator q2);
+        static void assert_can_erase(ConstIterator, ConstIterator,
+                                     ConstIterator, ConstIterator)
+        {}
 
         template <class ConstIterator>
         static void
-        assert_can_insert_before(ConstIterator first, ConstIterator last,
-                                 ConstIterator q);
+        assert_can_insert_before(ConstIterator, ConstIterator,
+                                 ConstIterator)
+        {}
     };
 }
 // namespace v1
@@ -0,0 +1,178 @@
+#ifndef Z_URAL_RANDOM_UNIFORM_INDEX_HPP_INCLUDED
+#define Z_URAL_RANDOM_UNIFORM_INDEX_HPP_INCLUDED
+
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/** @file ural/random/uniform_index.hpp
+ @brief Быстрая генерация равномерно распределённых индексов из интервалов
+ вида <tt> [0; n) </tt>, используемая алгоритмами тасовки и выборки.
+*/
+
+#include <ural/defs.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace ural
+{
+namespace experimental
+{
+    /// @cond false
+    namespace details
+    {
+        template <class URNG, class UInt>
+        struct is_full_range_engine
+         : std::integral_constant<bool, URNG::min() == 0
+                                        && URNG::max() == std::numeric_limits<UInt>::max()>
+        {};
+    }
+    // namespace details
+    /// @endcond
+
+    /** Индекс из интервала <tt> [0; n) </tt> вычисляется по 32 случайным
+    битам @c x как старшая половина произведения <tt> x * n </tt>. Чтобы
+    распределение было в точности равномерным, небольшая часть значений @c x
+    отбрасывается; деление требуется только в этом редком случае (метод
+    Лемира). Если генератор выдаёт 64 бита за раз, то каждое его значение
+    используется для получения двух индексов.
+    Индексы, не помещающиеся в 32 бита, а также индексы для генераторов, которые
+    выдают не все значения из 32 или 64 бит, генерируются с помощью
+    @c std::uniform_int_distribution.
+    @brief Генератор равномерно распределённых индексов
+    @tparam URNG тип генератора равномерно распределённых случайных чисел
+    */
+    template <class URNG>
+    class uniform_index_generator
+    {
+        static constexpr bool is_engine_64 = details::is_full_range_engine<URNG, std::uint64_t>::value;
+        static constexpr bool is_engine_32 = details::is_full_range_engine<URNG, std::uint32_t>::value;
+
+    public:
+        /// @brief Тип индекса
+        typedef std::uint64_t result_type;
+
+        /** @brief Конструктор
+        @param g генератор равномерно распределённых случайных чисел
+        @post Ссылка на @c g сохраняется, поэтому генератор должен
+        существовать всё время использования созданного объекта.
+        */
+        explicit uniform_index_generator(URNG & g)
+         : g_(g)
+         , cache_(0)
+         , has_cache_(false)
+        {}
+
+        /** @brief Генерация индекса
+        @param n количество возможных значений
+        @pre <tt> n > 0 </tt>
+        @return Случайное число из интервала <tt> [0; n) </tt>
+        */
+        result_type operator()(result_type n)
+        {
+            assert(n > 0);
+
+            using Full_range = std::integral_constant<bool, is_engine_64 || is_engine_32>;
+
+            if(n > std::numeric_limits<std::uint32_t>::max())
+            {
+                return this->impl(n, std::false_type{});
+            }
+
+            return this->impl(n, Full_range{});
+        }
+
+    private:
+        result_type impl(result_type n, std::false_type)
+        {
+            std::uniform_int_distribution<result_type> d(0, n - 1);
+            return d(g_);
+        }
+
+        result_type impl(result_type n, std::true_type)
+        {
+            auto const s = static_cast<std::uint32_t>(n);
+
+            auto m = std::uint64_t(this->bits()) * s;
+            auto low = static_cast<std::uint32_t>(m);
+
+            if(low < s)
+            {
+                // 2^32 mod s
+                auto const threshold = static_cast<std::uint32_t>(-s) % s;
+
+                while(low < threshold)
+                {
+                    m = std::uint64_t(this->bits()) * s;
+                    low = static_cast<std::uint32_t>(m);
+                }
+            }
+
+            return m >> 32;
+        }
+
+        std::uint32_t bits()
+        {
+            return this->bits_impl(std::integral_constant<bool, is_engine_64>{});
+        }
+
+        std::uint32_t bits_impl(std::true_type)
+        {
+            if(has_cache_)
+            {
+                has_cache_ = false;
+                return cache_;
+            }
+
+            std::uint64_t const x = g_();
+
+            cache_ = static_cast<std::uint32_t>(x >> 32);
+            has_cache_ = true;
+
+            return static_cast<std::uint32_t>(x);
+        }
+
+        std::uint32_t bits_impl(std::false_type)
+        {
+            return static_cast<std::uint32_t>(g_());
+        }
+
+    private:
+        URNG & g_;
+        std::uint32_t cache_;
+        bool has_cache_;
+    };
+
+    /** @brief Создание генератора равномерно распределённых индексов
+    @param g генератор равномерно распределённых случайных чисел
+    @return <tt> uniform_index_generator<URNG>(g) </tt>
+    */
+    template <class URNG>
+    uniform_index_generator<URNG>
+    make_uniform_index_generator(URNG & g)
+    {
+        return uniform_index_generator<URNG>(g);
+    }
+}
+// namespace experimental
+}
+// namespace ural
+
+#endif
+// Z_URAL_RANDOM_UNIFORM_INDEX_HPP_INCLUDED
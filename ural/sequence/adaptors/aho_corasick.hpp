@@ -0,0 +1,611 @@
+#ifndef Z_URAL_SEQUENCE_AHO_CORASICK_HPP_INCLUDED
+#define Z_URAL_SEQUENCE_AHO_CORASICK_HPP_INCLUDED
+
+/*  This file is part of Ural.
+
+    Ural is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Ural is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Ural.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/** @file ural/sequence/adaptors/aho_corasick.hpp
+ @brief Одновременный поиск вхождений множества образцов с помощью автомата
+ Ахо-Корасик
+*/
+
+#include <ural/utility/pipeable.hpp>
+#include <ural/sequence/base.hpp>
+#include <ural/sequence/make.hpp>
+#include <ural/tuple.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ural
+{
+namespace experimental
+{
+    /** Переходы бора образцов хранятся в виде двойного массива: переход из
+    состояния @c s по символу @c c ведёт в ячейку <tt> base(s) + c </tt>,
+    если поле @c check этой ячейки равно @c s. Поля @c base и @c check
+    хранятся рядом, поэтому каждый переход требует одного обращения к памяти,
+    а таблица занимает немногим больше места, чем сам бор. Если перехода нет,
+    то используются суффиксные ссылки, так что текст обрабатывается за
+    линейное время.
+
+    Образцы и текст рассматриваются как последовательности байтов. Пустые
+    образцы игнорируются, а из одинаковых образцов сообщается только о первом.
+    @brief Автомат Ахо-Корасик для поиска вхождений множества образцов
+    */
+    class aho_corasick_automaton
+    {
+    public:
+        // Типы
+        /// @brief Тип состояния
+        typedef std::int32_t state_type;
+
+        /// @brief Тип размера
+        typedef std::size_t size_type;
+
+        /// @brief Значение, обозначающее отсутствие состояния
+        static constexpr state_type no_state()
+        {
+            return -1;
+        }
+
+        /// @brief Значение, обозначающее отсутствие образца
+        static constexpr size_type npos()
+        {
+            return static_cast<size_type>(-1);
+        }
+
+        // Конструкторы
+        /** @brief Создание автомата по последовательности образцов
+        @param patterns последовательность образцов, каждый из которых
+        является последовательностью символов.
+        @post <tt> this->size() </tt> равно количеству образцов
+
+        Конструктор не участвует в разрешении перегрузки, если @c Input
+        является самим автоматом, чтобы не перехватывать копирование
+        неконстантных объектов.
+        */
+        template <class Input,
+                  class = typename std::enable_if<!std::is_same<typename std::decay<Input>::type,
+                                                                aho_corasick_automaton>::value>::type>
+        explicit aho_corasick_automaton(Input && patterns)
+        {
+            trie_builder trie;
+
+            for(auto in = ::ural::cursor_fwd<Input>(patterns); !!in; ++ in)
+            {
+                trie.add(::ural::cursor(*in), this->pattern_sizes_);
+            }
+
+            this->build(trie);
+        }
+
+        /** @brief Создание автомата по списку образцов
+        @param patterns список образцов
+        */
+        explicit aho_corasick_automaton(std::initializer_list<std::string> patterns)
+        {
+            trie_builder trie;
+
+            for(auto const & p : patterns)
+            {
+                trie.add(::ural::cursor(p), this->pattern_sizes_);
+            }
+
+            this->build(trie);
+        }
+
+        // Свойства
+        /** @brief Количество образцов
+        */
+        size_type size() const
+        {
+            return this->pattern_sizes_.size();
+        }
+
+        /** @brief Длина образца
+        @param id номер образца
+        @pre <tt> id < this->size() </tt>
+        */
+        size_type pattern_size(size_type id) const
+        {
+            assert(id < this->size());
+
+            return this->pattern_sizes_[id];
+        }
+
+        // Переходы
+        /** @brief Начальное состояние
+        */
+        static constexpr state_type root()
+        {
+            return 0;
+        }
+
+        /** @brief Переход по символу
+        @param s текущее состояние
+        @param c очередной символ текста
+        @return Состояние, соответствующее самому длинному суффиксу
+        прочитанного текста, который является префиксом одного из образцов.
+        */
+        state_type next(state_type s, unsigned char c) const
+        {
+            for(;;)
+            {
+                auto const t = this->cells_[s].base + c;
+
+                if(this->cells_[t].check == s)
+                {
+                    return t;
+                }
+
+                if(s == root())
+                {
+                    return root();
+                }
+
+                s = this->cells_[s].fail;
+            }
+        }
+
+        /** @brief Первое состояние цепочки вхождений
+        @param s состояние
+        @return Состояние @c s, если в нём заканчивается образец, иначе
+        ближайшее по суффиксным ссылкам состояние, в котором заканчивается
+        образец, или @c no_state(), если такого состояния нет.
+        */
+        state_type output(state_type s) const
+        {
+            return this->cells_[s].output;
+        }
+
+        /** @brief Следующее состояние цепочки вхождений
+        @param s состояние, в котором заканчивается образец
+        @return Следующее по суффиксным ссылкам состояние, в котором
+        заканчивается образец, или @c no_state(), если такого состояния нет.
+        */
+        state_type next_output(state_type s) const
+        {
+            return this->cells_[this->cells_[s].fail].output;
+        }
+
+        /** @brief Образец, заканчивающийся в данном состоянии
+        @param s состояние
+        @return Номер образца или @c npos()
+        */
+        size_type pattern(state_type s) const
+        {
+            return this->pattern_[s];
+        }
+
+    private:
+        static constexpr state_type free_cell()
+        {
+            return -1;
+        }
+
+        static constexpr state_type alphabet_size()
+        {
+            return UCHAR_MAX + 1;
+        }
+
+        // Всё, что нужно для обработки символа, находится в одной ячейке
+        struct cell
+        {
+            state_type base;
+            state_type check;
+            state_type fail;
+            state_type output;
+        };
+
+        static cell empty_cell()
+        {
+            return cell{0, free_cell(), root(), no_state()};
+        }
+
+        // Бор с упорядоченными списками потомков, используется при построении
+        struct trie_builder
+        {
+            struct node
+            {
+                std::vector<std::pair<unsigned char, size_type>> children;
+                size_type pattern = npos();
+            };
+
+            trie_builder()
+             : nodes(1)
+            {}
+
+            template <class Cursor>
+            void add(Cursor in, std::vector<size_type> & pattern_sizes)
+            {
+                size_type u = 0;
+                size_type length = 0;
+
+                for(; !!in; ++ in, (void) ++ length)
+                {
+                    auto const c = static_cast<unsigned char>(*in);
+                    auto & children = this->nodes[u].children;
+
+                    auto pos = std::lower_bound(children.begin(), children.end(),
+                                                std::make_pair(c, size_type(0)));
+
+                    if(pos != children.end() && pos->first == c)
+                    {
+                        u = pos->second;
+                        continue;
+                    }
+
+                    children.insert(pos, std::make_pair(c, this->nodes.size()));
+                    u = this->nodes.size();
+                    this->nodes.emplace_back();
+                }
+
+                if(length > 0 && this->nodes[u].pattern == npos())
+                {
+                    this->nodes[u].pattern = pattern_sizes.size();
+                }
+
+                pattern_sizes.push_back(length);
+            }
+
+            std::vector<node> nodes;
+        };
+
+        /* Кандидатами в base являются только значения, при которых ячейка
+        первого потомка свободна, поэтому заполненные участки массива не
+        просматриваются. Если ни один кандидат не подходит, то потомки
+        размещаются за концом массива.
+        */
+        template <class Children>
+        state_type find_base(Children const & children,
+                             std::set<state_type> & free_cells)
+        {
+            auto const c0 = static_cast<state_type>(children.front().first);
+            auto const size = static_cast<state_type>(cells_.size());
+
+            // Ячейки за концом массива свободны
+            auto const fits = [&](state_type b)
+            {
+                return std::all_of(children.begin(), children.end(),
+                                   [&](std::pair<unsigned char, size_type> const & x)
+                                   {
+                                       return b + x.first >= size
+                                              || cells_[b + x.first].check == free_cell();
+                                   });
+            };
+
+            auto b = std::max(state_type(1), size - c0);
+
+            for(auto const t : free_cells)
+            {
+                if(t - c0 >= 1 && fits(t - c0))
+                {
+                    b = t - c0;
+                    break;
+                }
+            }
+
+            if(b + alphabet_size() > size)
+            {
+                cells_.resize(static_cast<size_type>(b + alphabet_size()), empty_cell());
+
+                for(auto t = size; t != b + alphabet_size(); ++ t)
+                {
+                    free_cells.insert(free_cells.end(), t);
+                }
+            }
+
+            return b;
+        }
+
+        /* Для каждой вершины выбирается наименьшее значение base, при котором
+        все ячейки её потомков свободны. Вершины обрабатываются в порядке
+        обхода в ширину, поэтому суффиксная ссылка потомка вычисляется
+        переходом из суффиксной ссылки родителя.
+        */
+        void build(trie_builder const & trie)
+        {
+            auto const & nodes = trie.nodes;
+
+            assert(nodes.size() < static_cast<size_type>(std::numeric_limits<state_type>::max() / 2));
+
+            std::vector<state_type> cell_of(nodes.size(), free_cell());
+            cell_of[0] = root();
+
+            cells_.assign(alphabet_size(), empty_cell());
+            cells_[root()].check = no_state() - 1;
+
+            std::set<state_type> free_cells;
+
+            for(state_type t = 1; t != alphabet_size(); ++ t)
+            {
+                free_cells.insert(t);
+            }
+
+            state_type max_base = 0;
+
+            std::vector<size_type> queue(1, 0);
+
+            for(size_type k = 0; k != queue.size(); ++ k)
+            {
+                auto const & u = nodes[queue[k]];
+
+                if(u.children.empty())
+                {
+                    continue;
+                }
+
+                auto const b = this->find_base(u.children, free_cells);
+
+                auto const s = cell_of[queue[k]];
+                cells_[s].base = b;
+                max_base = std::max(max_base, b);
+
+                for(auto const & x : u.children)
+                {
+                    free_cells.erase(b + x.first);
+                    cells_[b + x.first].check = s;
+                    cell_of[x.second] = b + x.first;
+                    queue.push_back(x.second);
+                }
+            }
+
+            // Переход next никогда не выходит за пределы массива
+            cells_.resize(static_cast<size_type>(max_base + alphabet_size()), empty_cell());
+
+            pattern_.assign(cells_.size(), npos());
+
+            for(auto const v : queue)
+            {
+                pattern_[cell_of[v]] = nodes[v].pattern;
+            }
+
+            for(auto const v : queue)
+            {
+                auto const s = cell_of[v];
+
+                for(auto const & x : nodes[v].children)
+                {
+                    auto const t = cell_of[x.second];
+
+                    auto const f = (s == root()) ? root() : this->next(cells_[s].fail, x.first);
+
+                    cells_[t].fail = f;
+                    cells_[t].output = (pattern_[t] != npos()) ? t : cells_[f].output;
+                }
+            }
+        }
+
+    private:
+        std::vector<cell> cells_;
+        std::vector<size_type> pattern_;
+        std::vector<size_type> pattern_sizes_;
+    };
+
+    /** Элементами базовой последовательности могут быть символы (например,
+    при чтении из @c istream_cursor) или строки (например, при чтении из
+    @c by_line_cursor). Во втором случае вхождения ищутся внутри каждой
+    строки отдельно, а позиция отсчитывается от начала объединения всех строк.
+    @brief Курсор вхождений образцов автомата Ахо-Корасик в последовательность
+    символов
+    @tparam Input тип базового курсора
+    */
+    template <class Input>
+    class aho_corasick_cursor
+     : public cursor_base<aho_corasick_cursor<Input>>
+    {
+        using Automaton = aho_corasick_automaton;
+        using state_type = Automaton::state_type;
+
+        using Is_text = std::is_integral<value_type_t<Input>>;
+
+    public:
+        // Типы
+        /// @brief Тип расстояния
+        typedef std::size_t distance_type;
+
+        /** @brief Тип значения: позиция начала вхождения и номер образца
+        */
+        typedef tuple<distance_type, Automaton::size_type> value_type;
+
+        /// @brief Тип ссылки
+        typedef value_type reference;
+
+        /// @brief Тип указателя
+        typedef value_type const * pointer;
+
+        /// @brief Категория курсора
+        using cursor_tag = common_tag_t<typename Input::cursor_tag, finite_input_cursor_tag>;
+
+        // Конструкторы
+        /** @brief Конструктор
+        @param in базовый курсор
+        @param automaton автомат
+        @pre Время жизни @c automaton больше, чем время жизни курсора и его
+        копий.
+        */
+        aho_corasick_cursor(Input in, Automaton const & automaton)
+         : base_(std::move(in))
+         , automaton_(std::addressof(automaton))
+         , state_(Automaton::root())
+         , output_(Automaton::no_state())
+         , position_(0)
+         , offset_(0)
+        {
+            this->seek();
+        }
+
+        // Адаптор курсора
+        /** @brief Базовый курсор
+        @return Константная ссылка на базовый курсор
+        */
+        Input const & base() const
+        {
+            return this->base_;
+        }
+
+        /** @brief Используемый автомат
+        */
+        Automaton const & automaton() const
+        {
+            return *this->automaton_;
+        }
+
+        // Однопроходный курсор
+        /** @brief Проверка исчерпания
+        @return @b true, если вхождений больше нет, иначе --- @b false.
+        */
+        bool operator!() const
+        {
+            return this->output_ == Automaton::no_state();
+        }
+
+        /** @brief Текущее вхождение
+        @pre <tt> !*this == false </tt>
+        @return Кортеж из позиции первого символа вхождения и номера образца
+        */
+        reference front() const
+        {
+            assert(!!*this);
+
+            auto const id = this->automaton().pattern(this->output_);
+
+            return value_type(this->position_ - this->automaton().pattern_size(id), id);
+        }
+
+        /** @brief Переход к следующему вхождению
+        @pre <tt> !*this == false </tt>
+        */
+        void pop_front()
+        {
+            assert(!!*this);
+
+            this->output_ = this->automaton().next_output(this->output_);
+
+            if(this->output_ == Automaton::no_state())
+            {
+                this->seek();
+            }
+        }
+
+    private:
+        void seek()
+        {
+            this->seek(Is_text{});
+        }
+
+        bool step(unsigned char c)
+        {
+            state_ = this->automaton().next(state_, c);
+            ++ position_;
+
+            output_ = this->automaton().output(state_);
+
+            return output_ != Automaton::no_state();
+        }
+
+        void seek(std::true_type)
+        {
+            for(; !!base_;)
+            {
+                auto const c = static_cast<unsigned char>(base_.front());
+                base_.pop_front();
+
+                if(this->step(c))
+                {
+                    return;
+                }
+            }
+        }
+
+        void seek(std::false_type)
+        {
+            for(; !!base_; base_.pop_front(), offset_ = 0, state_ = Automaton::root())
+            {
+                auto && line = base_.front();
+                auto const n = line.size();
+
+                for(; offset_ < n;)
+                {
+                    auto const c = static_cast<unsigned char>(line[offset_]);
+                    ++ offset_;
+
+                    if(this->step(c))
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+
+    private:
+        Input base_;
+        Automaton const * automaton_;
+        state_type state_;
+        state_type output_;
+        distance_type position_;
+        std::size_t offset_;
+    };
+
+    /** @brief Тип функционального объекта для создания @c aho_corasick_cursor
+    */
+    class make_aho_corasick_cursor_fn
+    {
+    public:
+        /** @brief Создание курсора вхождений образцов
+        @param in входная последовательность
+        @param automaton автомат
+        @return <tt> aho_corasick_cursor<Cursor>(cursor_fwd<Input>(in), automaton) </tt>,
+        где @c Cursor --- <tt> cursor_type_t<Input> </tt>.
+        */
+        template <class Input>
+        aho_corasick_cursor<cursor_type_t<Input>>
+        operator()(Input && in, aho_corasick_automaton const & automaton) const
+        {
+            using Cursor = aho_corasick_cursor<cursor_type_t<Input>>;
+            return Cursor(::ural::cursor_fwd<Input>(in), automaton);
+        }
+    };
+
+    namespace
+    {
+        /// @brief Функциональный объект для создания @c aho_corasick_cursor
+        constexpr auto const & make_aho_corasick_cursor
+            = odr_const<make_aho_corasick_cursor_fn>;
+
+        /** @brief Объект для создания @c aho_corasick_cursor в конвейерном
+        стиле.
+        */
+        constexpr auto const & aho_corasick_matches
+            = odr_const<pipeable_maker<make_aho_corasick_cursor_fn>>;
+    }
+}
+// namespace experimental
+}
+// namespace ural
+
+#endif
+// Z_URAL_SEQUENCE_AHO_CORASICK_HPP_INCLUDED
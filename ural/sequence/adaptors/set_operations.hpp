@@ -26,10 +26,100 @@
 #include <ural/functional.hpp>
 #include <ural/optional.hpp>
 
+#include <vector>
+
 namespace ural
 {
 namespace experimental
 {
+    /// @cond false
+    namespace details
+    {
+        /* Количество шагов, которые делаются по одному элементу, прежде чем
+        перейти к экспоненциальному поиску. При сопоставимых длинах
+        последовательностей до экспоненциального поиска дело почти не доходит.
+        */
+        constexpr std::ptrdiff_t gallop_linear_steps = 4;
+
+        // Предусловие: pred(*in) == true
+        template <class Input, class Predicate>
+        void gallop_while(Input & in, Predicate pred, single_pass_cursor_tag)
+        {
+            for(++ in; !!in && pred(*in); ++ in)
+            {}
+        }
+
+        /* Экспоненциальный поиск: если одна из последовательностей сильно
+        опережает другую, то пропуск d элементов требует O(log d) сравнений.
+        */
+        template <class RACursor, class Predicate>
+        void gallop_while(RACursor & in, Predicate pred,
+                          finite_random_access_cursor_tag)
+        {
+            ++ in;
+
+            for(auto i = gallop_linear_steps; i > 0; -- i, ++ in)
+            {
+                if(!in || !pred(*in))
+                {
+                    return;
+                }
+            }
+
+            auto const n = in.size();
+
+            if(n == 0 || !pred(in[0]))
+            {
+                return;
+            }
+
+            // pred(in[lower]) == true, pred(in[upper]) == false или upper == n
+            auto lower = 0*n;
+            auto upper = 0*n + 1;
+
+            for(; upper < n && pred(in[upper]); upper *= 2)
+            {
+                lower = upper;
+            }
+
+            if(upper > n)
+            {
+                upper = n;
+            }
+
+            ++ lower;
+
+            while(lower < upper)
+            {
+                auto const middle = lower + (upper - lower) / 2;
+
+                if(pred(in[middle]))
+                {
+                    lower = middle + 1;
+                }
+                else
+                {
+                    upper = middle;
+                }
+            }
+
+            in += lower;
+        }
+
+        /* Пропускает элементы курсора in, предшествующие value
+        Предусловие: cmp(*in, value) == true
+        */
+        template <class Input, class T, class Compare>
+        void gallop_to(Input & in, T const & value, Compare const & cmp)
+        {
+            auto pred = [&](auto const & x) { return cmp(x, value); };
+
+            details::gallop_while(in, pred, ::ural::make_cursor_tag(in));
+        }
+    }
+    // namespace details
+    /// @endcond
+
     enum class set_operations_state
     {
         first,
@@ -271,6 +361,245 @@ namespace experimental
                                             ural::less<>{});
     }
 
+    /** Слияние выполняется с помощью дерева проигравших: во внутренних узлах
+    хранятся номера курсоров, проигравших соответствующий матч, поэтому после
+    извлечения элемента достаточно переиграть матчи на пути от листа к корню,
+    то есть выполнить <tt> log2(k) </tt> сравнений, где @c k --- количество
+    базовых курсоров. Из эквивалентных элементов первым выбирается элемент
+    курсора с меньшим номером, то есть слияние устойчиво.
+    @brief Курсор последовательности элементов, полученной в результате
+    слияния произвольного количества базовых последовательностей.
+    @tparam Input тип базовых курсоров
+    @tparam Compare функция сравнения
+    */
+    template <class Input, class Compare = ural::less<> >
+    class k_merge_cursor
+     : public cursor_base<k_merge_cursor<Input, Compare>, Compare>
+    {
+        BOOST_CONCEPT_ASSERT((concepts::SinglePassCursor<Input>));
+        BOOST_CONCEPT_ASSERT((concepts::ReadableCursor<Input>));
+
+        typedef bool(Compare_signature)(typename Input::reference,
+                                        typename Input::reference);
+
+        BOOST_CONCEPT_ASSERT((concepts::Callable<Compare, Compare_signature>));
+
+        typedef cursor_base<k_merge_cursor, Compare> Base_class;
+
+        typedef std::vector<Input> Bases;
+        typedef typename Bases::size_type Index;
+
+    public:
+        /** @brief Оператора "равно"
+        @param x, y аргументы
+        @return <tt> x.bases() == y.bases() && x.function() == y.function() </tt>
+        */
+        friend bool operator==(k_merge_cursor const & x, k_merge_cursor const & y)
+        {
+            return x.bases() == y.bases() && x.function() == y.function();
+        }
+
+        /// @brief Тип ссылки
+        using reference = typename Input::reference;
+
+        /// @brief Тип значения
+        using value_type = value_type_t<Input>;
+
+        /// @brief Категория курсора
+        using cursor_tag = common_type_t<typename Input::cursor_tag,
+                                         finite_input_cursor_tag>;
+
+        /// @brief Тип указателя
+        using pointer = typename Input::pointer;
+
+        /// @brief Тип расстояния
+        using distance_type = difference_type_t<Input>;
+
+        /** @brief Конструктор
+        @param ins базовые курсоры
+        @param cmp функция сравнения
+        @pre Каждый из курсоров @c ins упорядочен относительно @c cmp
+        @post <tt> this->function() == cmp </tt>
+        @post <tt> this->bases() == ins </tt>
+        */
+        explicit k_merge_cursor(std::vector<Input> ins, Compare cmp = Compare{})
+         : Base_class(std::move(cmp))
+         , ins_(std::move(ins))
+         , tree_(ins_.size() + (ins_.empty() ? 1 : 0), ins_.size())
+        {
+            this->build();
+        }
+
+        // Однопроходый курсор
+        /** @brief Проверка исчерпания
+        @return @b true, если курсор исчерпан, иначе --- @b false.
+        */
+        bool operator!() const
+        {
+            return ins_.empty() || !ins_[tree_[0]];
+        }
+
+        /** @brief Текущий элемент
+        @pre <tt> !*this == false </tt>
+        @return Ссылка на текущий элемент
+        */
+        reference front() const
+        {
+            assert(!!*this);
+
+            return *ins_[tree_[0]];
+        }
+
+        /** @brief Переход к следующему элементу
+        @pre <tt> !*this == false </tt>
+        */
+        void pop_front()
+        {
+            assert(!!*this);
+
+            auto winner = tree_[0];
+            ++ ins_[winner];
+
+            auto const k = ins_.size();
+
+            for(auto node = (winner + k) / 2; node > 0; node /= 2)
+            {
+                if(this->beats(tree_[node], winner))
+                {
+                    std::swap(tree_[node], winner);
+                }
+            }
+
+            tree_[0] = winner;
+        }
+
+        // Адаптор курсоров
+        /** @brief Используемая функция сравнения
+        @return Используемая функция сравнения
+        */
+        Compare const & function() const
+        {
+            return this->payload();
+        }
+
+        //@{
+        /** @brief Базовые курсоры
+        @return Ссылка на массив базовых курсоров
+        */
+        std::vector<Input> const & bases() const &
+        {
+            return this->ins_;
+        }
+
+        std::vector<Input> && bases() &&
+        {
+            return std::move(this->ins_);
+        }
+        //@}
+
+    private:
+        /* Определяет, должен ли элемент курсора x предшествовать элементу
+        курсора y. Исчерпанные курсоры проигрывают всем остальным.
+        */
+        bool beats(Index x, Index y) const
+        {
+            if(!ins_[y])
+            {
+                return true;
+            }
+
+            if(!ins_[x])
+            {
+                return false;
+            }
+
+            if(x < y)
+            {
+                return !this->function()(*ins_[y], *ins_[x]);
+            }
+            else
+            {
+                return this->function()(*ins_[x], *ins_[y]);
+            }
+        }
+
+        /* Листья соответствуют индексам [k, 2k), узлы --- индексам [1, k).
+        Первый пришедший в узел участник ждёт второго, после чего в узле
+        остаётся проигравший, а победитель продолжает подъём.
+        */
+        void build()
+        {
+            auto const k = ins_.size();
+            auto const none = k;
+
+            for(Index i = 0; i != k; ++ i)
+            {
+                auto winner = i;
+                auto node = (winner + k) / 2;
+
+                for(; node > 0; node /= 2)
+                {
+                    if(tree_[node] == none)
+                    {
+                        tree_[node] = winner;
+                        break;
+                    }
+
+                    if(this->beats(tree_[node], winner))
+                    {
+                        std::swap(tree_[node], winner);
+                    }
+                }
+
+                if(node == 0)
+                {
+                    tree_[0] = winner;
+                }
+            }
+        }
+
+    private:
+        Bases ins_;
+        std::vector<Index> tree_;
+    };
+
+    /** @brief Создание курсора слияния нескольких последовательностей
+    @param ins последовательность упорядоченных последовательностей
+    @param cmp функция сравнения
+    @return <tt> k_merge_cursor<Input, Compare>(bases, cmp) </tt>, где
+    @c bases --- курсоры элементов @c ins.
+    */
+    template <class Inputs, class Compare>
+    auto k_merged(Inputs && ins, Compare cmp)
+    -> k_merge_cursor<cursor_type_t<reference_type_t<cursor_type_t<Inputs>>>,
+                      decltype(ural::make_callable(std::move(cmp)))>
+    {
+        using Input = cursor_type_t<reference_type_t<cursor_type_t<Inputs>>>;
+        using Result = k_merge_cursor<Input, decltype(ural::make_callable(std::move(cmp)))>;
+
+        std::vector<Input> bases;
+
+        for(auto && in : ::ural::cursor_fwd<Inputs>(ins))
+        {
+            bases.push_back(::ural::cursor_fwd<decltype(in)>(in));
+        }
+
+        return Result(std::move(bases), ural::make_callable(std::move(cmp)));
+    }
+
+    /** @brief Создание курсора слияния нескольких последовательностей с
+    использованием функции сравнения по умолчанию
+    @param ins последовательность упорядоченных последовательностей
+    @return <tt> k_merged(std::forward<Inputs>(ins), ural::less<>{}) </tt>
+    */
+    template <class Inputs>
+    auto k_merged(Inputs && ins)
+    -> k_merge_cursor<cursor_type_t<reference_type_t<cursor_type_t<Inputs>>>>
+    {
+        return ::ural::experimental::k_merged(std::forward<Inputs>(ins),
+                                              ural::less<>{});
+    }
+
     /** @brief Курсор последовательности элементов, полученной в результате
     пересечения множеств элементов двух базовых последовательностей
     @tparam Input1 Тип первого базового курсора
@@ -428,11 +757,11 @@ namespace experimental
             {
                 if(function()(*in1_, *in2_))
                 {
-                    ++ in1_;
+                    details::gallop_to(in1_, *in2_, this->function());
                 }
                 else if(function()(*in2_, *in1_))
                 {
-                    ++ in2_;
+                    details::gallop_to(in2_, *in1_, this->function());
                 }
                 else
                 {
@@ -622,7 +951,7 @@ namespace experimental
                 }
                 else if(function()(*in2_, *in1_))
                 {
-                    ++ in2_;
+                    details::gallop_to(in2_, *in1_, this->function());
                 }
                 else
                 {
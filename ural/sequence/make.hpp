@@ -226,10 +226,16 @@ inline namespace v1
     //@}
 
     /** @brief Класс-характеристика для определения типа курсора
+    @details Если курсор для @c S создать нельзя, то член @c type не
+    определён, что позволяет исключать перегрузки алгоритмов из рассмотрения.
     @tparam S тип последовательности
     */
-    template <class S>
+    template <class S, class = void>
     struct cursor_type
+    {};
+
+    template <class S>
+    struct cursor_type<S, void_t<decltype(cursor(std::declval<S>()))>>
      : declare_type<typename std::decay<decltype(cursor(std::declval<S>()))>::type>
     {};
 
@@ -21,13 +21,109 @@
  @brief Классы и функции для многопточного программирования
 */
 
+#include <ural/defs.hpp>
+
 #include <cstddef>
 
 #include <atomic>
+#include <future>
 #include <mutex>
+#include <thread>
 
 namespace ural
 {
+inline namespace v1
+{
+    /** @brief Стратегия выполнения алгоритмов: параллельное выполнение
+    @details Количество потоков, равное нулю, означает, что используется
+    <tt> std::thread::hardware_concurrency() </tt> потоков.
+    */
+    class parallel_execution_policy
+    {
+    public:
+        /** @brief Конструктор
+        @post <tt> this->threads() == std::thread::hardware_concurrency() </tt>,
+        если оно отлично от нуля, иначе --- @b 1
+        */
+        constexpr parallel_execution_policy()
+         : threads_(0)
+        {}
+
+        /** @brief Конструктор
+        @param threads максимальное количество потоков
+        */
+        constexpr explicit parallel_execution_policy(std::size_t threads)
+         : threads_(threads)
+        {}
+
+        /** @brief Стратегия с заданным количеством потоков
+        @param threads максимальное количество потоков
+        @return <tt> parallel_execution_policy(threads) </tt>
+        */
+        constexpr parallel_execution_policy
+        operator()(std::size_t threads) const
+        {
+            return parallel_execution_policy(threads);
+        }
+
+        /// @brief Максимальное количество потоков
+        std::size_t threads() const
+        {
+            if(threads_ != 0)
+            {
+                return threads_;
+            }
+
+            auto const n = std::thread::hardware_concurrency();
+            return n == 0 ? 1 : n;
+        }
+
+    private:
+        std::size_t threads_;
+    };
+
+    namespace
+    {
+        /// @brief Стратегия параллельного выполнения алгоритмов
+        constexpr auto const & par = odr_const<parallel_execution_policy>;
+    }
+
+    /// @cond false
+    namespace details
+    {
+        /* Вызывает f1 и f2, если parallel истинно, то f2 выполняется в
+        отдельном потоке. Исключения из f2 передаются вызывающему потоку.
+        */
+        template <class F1, class F2>
+        void parallel_invoke(bool parallel, F1 && f1, F2 && f2)
+        {
+            if(!parallel)
+            {
+                f1();
+                f2();
+                return;
+            }
+
+            auto task = std::async(std::launch::async, std::forward<F2>(f2));
+
+            try
+            {
+                f1();
+            }
+            catch(...)
+            {
+                task.wait();
+                throw;
+            }
+
+            task.get();
+        }
+    }
+    // namespace details
+    /// @endcond
+}
+// namespace v1
+
 namespace experimental
 {
     /** @brief Стратегия многопотоночти: многопоточная программа, использовать
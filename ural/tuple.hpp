@@ -86,6 +86,28 @@ inline namespace v1
          : Base(std::move(x))
         {}
 
+        //@{
+        /** @brief Присваивает элементам кортежа соответствующие элементы
+        стандартного кортежа. Для кортежа ссылок присваивание выполняется
+        объектам, на которые они ссылаются.
+        @param x стандартный кортеж
+        @return <tt> *this </tt>
+        */
+        template <class... Us>
+        tuple & operator=(std::tuple<Us...> const & x)
+        {
+            Base::operator=(x);
+            return *this;
+        }
+
+        template <class... Us>
+        tuple & operator=(std::tuple<Us...> && x)
+        {
+            Base::operator=(std::move(x));
+            return *this;
+        }
+        //@}
+
         //@{
         /** @brief Доступ к элементам по "статическому индексу"
         @tparam Index номер элемента